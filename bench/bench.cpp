@@ -0,0 +1,905 @@
+/**
+* @file bench.cpp
+ * @brief Mesures de débit des noyaux du moteur (à compiler en Release).
+ *
+ * Usage : `bench [filtre]` — n’exécute que les mesures dont le nom contient `filtre`.
+ * Le catalogue est lu depuis `Shapes.json` (copié dans le dossier de build par CMake).
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "AI/AlphaBetaAgent.hpp"
+#include "AI/ExchangeAdvisor.hpp"
+#include "AI/FinalCellSolver.hpp"
+#include "AI/HeuristicPolicy.hpp"
+#include "AI/MctsAgent.hpp"
+#include "AI/StoneAdvisor.hpp"
+#include "Board/Board.hpp"
+#include "Engine/BatchLegality.hpp"
+#include "Engine/BatchPlayout.hpp"
+#include "Engine/Coverage.hpp"
+#include "Engine/MoveGenerator.hpp"
+#include "Engine/PlacementCache.hpp"
+#include "Engine/Playout.hpp"
+#include "Engine/Position.hpp"
+#include "Engine/Shape.hpp"
+#include "Engine/Territory.hpp"
+#include "Engine/TileBag.hpp"
+#include "Player/Player.hpp"
+#include "Tile/InitTiles.hpp"
+#include "Tile/TileQueue.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Secondes écoulées depuis `t0`.
+ */
+double secondsSince(Clock::time_point t0) {
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+
+/**
+ * @brief Construit une position de milieu de partie par placements aléatoires légaux.
+ * @param numPlayers Nombre de joueurs (fixe la taille du plateau).
+ * @param turns Nombre de tours joués.
+ * @param shapes Catalogue précalculé.
+ * @param rng Générateur.
+ * @return Plateau obtenu.
+ */
+Board randomPosition(int numPlayers, int turns, const std::vector<ShapeSet>& shapes, std::mt19937& rng) {
+    Board board(numPlayers);
+    const int side = board.getRows();
+    for (int p = 1; p <= numPlayers; ++p) {
+        int x, y;
+        do { x = rng() % side; y = rng() % side; } while (board.getGrid()[y][x] != '.');
+        board.placeTile(x, y, p);
+    }
+    MoveList moves;
+    for (int t = 0; t < turns; ++t) {
+        int pid = 1 + t % numPlayers;
+        const ShapeSet& s = shapes[rng() % shapes.size()];
+        MoveGenerator::generate(board, pid, s, moves);
+        if (moves.empty()) continue;
+        for (auto [x, y] : MoveGenerator::footprint(s, moves[rng() % moves.size()]))
+            board.placeTile(x, y, pid);
+    }
+    return board;
+}
+
+/**
+ * @brief Débit de la génération de coups (coups générés par seconde).
+ */
+void benchMoveGeneration(const std::vector<ShapeSet>& shapes) {
+    for (int numPlayers : {4, 9}) {
+        std::mt19937 rng(12345);
+        std::vector<Board> boards;
+        for (int i = 0; i < 16; ++i) boards.push_back(randomPosition(numPlayers, 6 * numPlayers, shapes, rng));
+
+        std::vector<PlacementMasks> masks;
+        for (const auto& b : boards)
+            for (int p = 1; p <= numPlayers; ++p) masks.push_back(MoveGenerator::masksFor(b, p));
+
+        MoveList moves;
+        std::size_t generated = 0, calls = 0;
+        auto t0 = Clock::now();
+        while (secondsSince(t0) < 1.0) {
+            for (const auto& m : masks) {
+                for (const auto& s : shapes) {
+                    MoveGenerator::generate(m, s, moves);
+                    generated += moves.size();
+                    ++calls;
+                }
+            }
+        }
+        double dt = secondsSince(t0);
+        const int side = boards.front().getRows();
+        std::printf("movegen %dx%d: %.2f M moves/s, %.2f M tiles/s (%.1f moves/tile)\n",
+                    side, side, generated / dt / 1e6, calls / dt / 1e6,
+                    calls ? double(generated) / calls : 0.0);
+    }
+}
+
+/**
+ * @brief Coût amorti du décompte des placements légaux de toutes les tuiles du catalogue,
+ *        pour tous les joueurs et à chaque tour, sans cache puis avec PlacementCache,
+ *        sur une même suite de coups aléatoires.
+ */
+void benchPlacementCache(const std::vector<ShapeSet>& shapes) {
+    for (int numPlayers : {4, 9}) {
+        double seconds[2] = {0.0, 0.0};
+        std::size_t checksum[2] = {0, 0};
+        PlacementCache::Stats stats;
+        for (int useCache = 0; useCache < 2; ++useCache) {
+            std::mt19937 rng(777);
+            Board board(numPlayers);
+            const int side = board.getRows();
+            for (int p = 1; p <= numPlayers; ++p) {
+                int x, y;
+                do { x = rng() % side; y = rng() % side; } while (board.getGrid()[y][x] != '.');
+                board.placeTile(x, y, p);
+            }
+            PlacementCache cache(board);
+            MoveList moves;
+            for (int t = 0; t < 9 * numPlayers; ++t) {
+                const int pid = 1 + t % numPlayers;
+                auto t0 = Clock::now();
+                for (int p = 1; p <= numPlayers; ++p) {
+                    for (const auto& s : shapes) {
+                        checksum[useCache] += useCache
+                            ? cache.countMoves(p, s)
+                            : MoveGenerator::countMoves(MoveGenerator::masksFor(board, p), s);
+                    }
+                }
+                seconds[useCache] += secondsSince(t0);
+                const ShapeSet& s = shapes[rng() % shapes.size()];
+                MoveGenerator::generate(board, pid, s, moves);
+                if (!moves.empty())
+                    board.placeFootprint(MoveGenerator::footprint(s, moves[rng() % moves.size()]), pid);
+            }
+            if (useCache) stats = cache.stats();
+        }
+        const int side = numPlayers <= 4 ? 20 : 30;
+        std::printf("movecache %dx%d (%d players): direct %.2f ms/turn, cached %.2f ms/turn, "
+                    "%zu full / %zu incremental rebuilds%s\n",
+                    side, side, numPlayers,
+                    seconds[0] * 1e3 / (9 * numPlayers), seconds[1] * 1e3 / (9 * numPlayers),
+                    stats.fullRebuilds, stats.incrementalUpdates,
+                    checksum[0] == checksum[1] ? "" : " (MISMATCH)");
+    }
+}
+
+/**
+ * @brief Position de la manche `round` (manches précédentes jouées au hasard) pour les
+ *        mesures de recherche, avec des joueurs réels (identifiants de Player).
+ */
+Position searchPosition(const std::vector<Player>& players, int round, const std::vector<ShapeSet>& shapes,
+                        std::mt19937& rng) {
+    const int numPlayers = static_cast<int>(players.size());
+    Board board(numPlayers);
+    const int side = board.getRows();
+    for (const auto& pl : players) {
+        int x, y;
+        do { x = rng() % side; y = rng() % side; } while (board.getGrid()[y][x] != '.');
+        board.placeTile(x, y, pl.getID());
+    }
+    MoveList moves;
+    for (int t = 0; t < (round - 1) * numPlayers; ++t) {
+        const int pid = players[t % numPlayers].getID();
+        const ShapeSet& s = shapes[rng() % shapes.size()];
+        MoveGenerator::generate(board, pid, s, moves);
+        if (!moves.empty())
+            board.placeFootprint(MoveGenerator::footprint(s, moves[rng() % moves.size()]), pid);
+    }
+    return Position::fromBoard(board, players, round, 0);
+}
+
+/**
+ * @brief Joueurs de mesure ("p0", "p1", …).
+ */
+std::vector<Player> benchPlayers(int numPlayers) {
+    std::vector<Player> players;
+    for (int p = 0; p < numPlayers; ++p) players.emplace_back("p" + std::to_string(p), "red");
+    return players;
+}
+
+/**
+ * @brief Débit de MctsAgent (parties simulées par seconde) sur une décision de début
+ *        de partie puis de milieu de partie, 1 s par décision.
+ */
+void benchMcts(const InitTiles& catalog, const std::vector<ShapeSet>& shapes) {
+    for (int numPlayers : {4, 9}) {
+        const std::vector<Player> players = benchPlayers(numPlayers);
+        TileQueue queue;
+        queue.setSamplingMode(TileQueue::SamplingMode::WeightedShuffle);
+        queue.initFrom(catalog, true, 99);
+
+        for (int round : {1, 4}) {
+            std::mt19937 rng(4242);
+            const Position position = searchPosition(players, round, shapes, rng);
+            MctsAgent::Config config;
+            config.seconds = 1.0;
+            config.seed = 1;
+            MctsAgent agent(config);
+            const TileBag bag = TileBag::fromQueue(queue, queue.weights());
+            agent.decideTurn({position, bag, shapes, static_cast<int>(rng() % shapes.size())});
+            const auto& st = agent.lastStats();
+            std::printf("mcts %dx%d (%d players, round %d): %.0f playouts/s, %zu nodes, depth %d\n",
+                        position.rows(), position.cols(), numPlayers, round,
+                        st.playoutsPerSecond, st.nodes, st.maxDepth);
+        }
+    }
+}
+
+/**
+ * @brief Passage à l’échelle de MctsAgent : parties simulées par seconde à 1, 2, 4, … N fils
+ *        (N = cœurs disponibles), arbre partagé puis arbres par fil, 1 s par mesure.
+ */
+void benchMctsThreads(const InitTiles& catalog, const std::vector<ShapeSet>& shapes) {
+    const int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<int> counts;
+    for (int t = 1; t < cores; t *= 2) counts.push_back(t);
+    counts.push_back(cores);
+
+    for (int numPlayers : {4, 9}) {
+        const std::vector<Player> players = benchPlayers(numPlayers);
+        TileQueue queue;
+        queue.setSamplingMode(TileQueue::SamplingMode::WeightedShuffle);
+        queue.initFrom(catalog, true, 99);
+        std::mt19937 rng(4242);
+        const Position position = searchPosition(players, 4, shapes, rng);
+        const TileBag bag = TileBag::fromQueue(queue, queue.weights());
+        const int tile = static_cast<int>(rng() % shapes.size());
+
+        for (auto mode : {MctsAgent::Parallelism::Tree, MctsAgent::Parallelism::Root}) {
+            double single = 0.0;
+            for (int threads : counts) {
+                MctsAgent::Config config;
+                config.seconds = 1.0;
+                config.seed = 1;
+                config.threads = threads;
+                config.parallelism = mode;
+                MctsAgent agent(config);
+                agent.decideTurn({position, bag, shapes, tile});
+                const double rate = agent.lastStats().playoutsPerSecond;
+                if (threads == 1) single = rate;
+                std::printf("mcts-threads %dx%d (%d players, %s, %d threads): %.0f playouts/s (x%.2f)\n",
+                            position.rows(), position.cols(), numPlayers,
+                            mode == MctsAgent::Parallelism::Tree ? "tree" : "root", threads,
+                            rate, single > 0.0 ? rate / single : 0.0);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Coût du mode ISMCTS : itérations et parties simulées par seconde selon le nombre
+ *        d’ordres de pioche échantillonnés par itération (0 : tirages indépendants), 1 s par mesure.
+ */
+void benchIsmcts(const InitTiles& catalog, const std::vector<ShapeSet>& shapes) {
+    for (int numPlayers : {4, 9}) {
+        const std::vector<Player> players = benchPlayers(numPlayers);
+        TileQueue queue;
+        queue.setSamplingMode(TileQueue::SamplingMode::WeightedShuffle);
+        queue.initFrom(catalog, true, 99);
+        std::mt19937 rng(4242);
+        const Position position = searchPosition(players, 4, shapes, rng);
+        const TileBag bag = TileBag::fromQueue(queue, queue.weights());
+        const int tile = static_cast<int>(rng() % shapes.size());
+
+        for (int samples : {0, 1, 2, 4}) {
+            MctsAgent::Config config;
+            config.seconds = 1.0;
+            config.seed = 1;
+            config.determinizations = samples;
+            MctsAgent agent(config);
+            agent.decideTurn({position, bag, shapes, tile});
+            const auto& st = agent.lastStats();
+            std::printf("ismcts %dx%d (%d players, %d samples/iteration): %.0f iterations/s, %.0f playouts/s\n",
+                        position.rows(), position.cols(), numPlayers, samples,
+                        st.seconds > 0.0 ? st.iterations / st.seconds : 0.0, st.playoutsPerSecond);
+        }
+    }
+}
+
+/**
+ * @brief AlphaBetaAgent à 2 joueurs (20x20) et paranoïaque à 4 joueurs : profondeur atteinte,
+ *        nœuds par seconde et facteur de branchement effectif, 1 s par décision.
+ */
+void benchAlphaBeta(const InitTiles& catalog, const std::vector<ShapeSet>& shapes) {
+    for (int numPlayers : {2, 4}) {
+        const std::vector<Player> players = benchPlayers(numPlayers);
+        TileQueue queue;
+        queue.setSamplingMode(TileQueue::SamplingMode::WeightedShuffle);
+        queue.initFrom(catalog, true, 99);
+        for (int round : {1, 4}) {
+            std::mt19937 rng(4242);
+            const Position position = searchPosition(players, round, shapes, rng);
+            const TileBag bag = TileBag::fromQueue(queue, queue.weights());
+            AlphaBetaAgent::Config config;
+            config.seconds = 1.0;
+            AlphaBetaAgent agent(config);
+            agent.decideTurn({position, bag, shapes, static_cast<int>(rng() % shapes.size())});
+            const auto& st = agent.lastStats();
+            std::printf("alphabeta %dx%d (%d players, round %d): depth %d, %.0f nodes/s, branching %.2f, "
+                        "%zu table hits, %zu cutoffs\n",
+                        position.rows(), position.cols(), numPlayers, round, st.depth,
+                        st.nodesPerSecond, st.branching, st.tableHits, st.cutoffs);
+        }
+    }
+}
+
+/**
+ * @brief Respect de l’échéance à 9 joueurs (30x30) : pour chaque agent et chaque budget,
+ *        temps utilisé et dépassement maximal sur des décisions de la 1re à la 7e manche,
+ *        puis délai de réponse à une annulation demandée depuis un autre fil.
+ */
+void benchDeadline(const InitTiles& catalog, const std::vector<ShapeSet>& shapes) {
+    const std::vector<Player> players = benchPlayers(9);
+    TileQueue queue;
+    queue.setSamplingMode(TileQueue::SamplingMode::WeightedShuffle);
+    queue.initFrom(catalog, true, 99);
+    const TileBag bag = TileBag::fromQueue(queue, queue.weights());
+
+    MctsAgent::Config mctsConfig;
+    mctsConfig.seed = 1;
+    mctsConfig.threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    MctsAgent mcts(mctsConfig);
+    AlphaBetaAgent alphaBeta;
+
+    for (Agent* agent : {static_cast<Agent*>(&mcts), static_cast<Agent*>(&alphaBeta)}) {
+        for (double budget : {0.01, 0.1, 0.5}) {
+            double used = 0.0, worst = 0.0;
+            int decisions = 0, rows = 0, cols = 0;
+            for (int round : {1, 3, 5, 7}) {
+                std::mt19937 rng(4242 + round);
+                const Position position = searchPosition(players, round, shapes, rng);
+                rows = position.rows();
+                cols = position.cols();
+                agent->decideTurn({position, bag, shapes, static_cast<int>(rng() % shapes.size())},
+                                  SearchLimits::within(budget));
+                used += agent->lastBudget().used;
+                worst = std::max(worst, agent->lastBudget().overrun);
+                ++decisions;
+            }
+            std::printf("deadline %dx%d (9 players, %s, budget %.0f ms): %.1f ms used on average, "
+                        "worst overrun %.2f ms\n",
+                        rows, cols, agent->name().c_str(), budget * 1000.0, used / decisions * 1000.0, worst * 1000.0);
+        }
+
+        std::mt19937 rng(4242);
+        const Position position = searchPosition(players, 4, shapes, rng);
+        const SearchLimits limits = SearchLimits::within(10.0);
+        std::thread canceller([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            limits.token.cancel();
+        });
+        const auto t0 = std::chrono::steady_clock::now();
+        agent->decideTurn({position, bag, shapes, static_cast<int>(rng() % shapes.size())}, limits);
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        canceller.join();
+        std::printf("deadline %dx%d (9 players, %s, cancelled after 50 ms): returned after %.2f ms\n",
+                    position.rows(), position.cols(), agent->name().c_str(), elapsed * 1000.0);
+    }
+}
+
+/**
+ * @brief Temps de réponse d’ExchangeAdvisor (tuile en main + 5 tuiles de la fenêtre),
+ *        à 4 et 9 joueurs, en début, milieu et fin de partie : un fil, puis un fil par cœur.
+ */
+void benchExchangeAdvisor(const InitTiles& catalog, const std::vector<ShapeSet>& shapes) {
+    const int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    for (int numPlayers : {4, 9}) {
+        const std::vector<Player> players = benchPlayers(numPlayers);
+        TileQueue queue;
+        queue.setSamplingMode(TileQueue::SamplingMode::WeightedShuffle);
+        queue.initFrom(catalog, true, 99);
+        const TileBag bag = TileBag::fromQueue(queue, queue.weights());
+        for (int round : {1, 4, 7}) {
+            std::mt19937 rng(4242);
+            const Position position = searchPosition(players, round, shapes, rng);
+            const int tile = static_cast<int>(rng() % shapes.size());
+            double ms[2] = {0.0, 0.0};
+            int placements = 0;
+            for (int k = 0; k < 2; ++k) {
+                const ExchangeAdvisor advisor(k == 0 ? 1 : cores);
+                const int reps = 5;
+                const auto t0 = std::chrono::steady_clock::now();
+                for (int r = 0; r < reps; ++r) {
+                    placements = 0;
+                    for (const auto& o : advisor.rank({position, bag, shapes, tile})) placements += o.placements;
+                }
+                ms[k] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / reps;
+            }
+            std::printf("exchange %dx%d (%d players, round %d): %d placements, %.2f ms (1 thread), "
+                        "%.2f ms (%d threads)\n",
+                        position.rows(), position.cols(), numPlayers, round, placements, ms[0], ms[1], cores);
+        }
+    }
+}
+
+/**
+ * @brief Temps de classement de StoneAdvisor (toutes les cases vides, catalogue complet)
+ *        à 4 et 9 joueurs, comparé au recomptage complet des placements après chaque pierre
+ *        (extrapolé à partir de 16 cases).
+ */
+void benchStoneAdvisor(const std::vector<ShapeSet>& shapes) {
+    for (int numPlayers : {4, 9}) {
+        const std::vector<Player> players = benchPlayers(numPlayers);
+        for (int round : {1, 4, 7}) {
+            std::mt19937 rng(4242);
+            const Position position = searchPosition(players, round, shapes, rng);
+            const auto t0 = std::chrono::steady_clock::now();
+            const auto options = StoneAdvisor().rank(position, 0, shapes, std::size_t(-1));
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+            const std::size_t sample = std::min<std::size_t>(16, options.size());
+            std::size_t total = 0;
+            const auto t1 = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < sample; ++i) {
+                Position next = position;
+                next.placeStone(options[i].x, options[i].y);
+                for (int s = 0; s < next.numSeats(); ++s) {
+                    const PlacementMasks masks = next.masks(s);
+                    for (const auto& shape : shapes) total += MoveGenerator::countMoves(masks, shape);
+                }
+            }
+            const double naive = sample > 0
+                ? std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t1).count()
+                  / sample * options.size()
+                : 0.0;
+            std::printf("stone %dx%d (%d players, round %d): %zu cells ranked in %.2f ms, "
+                        "recounting all placements after each stone %.0f ms (%zu)\n",
+                        position.rows(), position.cols(), numPlayers, round, options.size(), ms, naive, total);
+        }
+    }
+}
+
+/**
+ * @brief Phase finale 1x1 après 9 manches : évaluation de toutes les ancres de tous les
+ *        sièges par FinalCellSolver, comparée à une pose rejouée par ancre (copie + score).
+ */
+void benchFinalCell(const std::vector<ShapeSet>& shapes) {
+    for (int numPlayers : {4, 9}) {
+        const std::vector<Player> players = benchPlayers(numPlayers);
+        std::mt19937 rng(4242);
+        const Position position = searchPosition(players, kMaxRounds + 1, shapes, rng);
+        const int reps = 200;
+        std::size_t candidates = 0, mismatches = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; ++r)
+            for (int s = 0; s < numPlayers; ++s) candidates += FinalCellSolver::evaluate(position, s).size();
+        const double solver = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / reps;
+
+        t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; ++r) {
+            for (int s = 0; s < numPlayers; ++s) {
+                std::optional<SeatScore> best;
+                for (int y = 0; y < position.rows(); ++y) {
+                    for (Row bits = position.anchors(s)[y]; bits; bits &= bits - 1) {
+                        Position next = position;
+                        next.placeCell(s, lowestBit(bits), y);
+                        const SeatScore sc = next.score(s);
+                        if (!best || sc.maxSquare > best->maxSquare
+                            || (sc.maxSquare == best->maxSquare && sc.cellCount > best->cellCount)) best = sc;
+                    }
+                }
+                if (r > 0 || !best) continue;
+                const auto choice = FinalCellSolver::best(position, s);
+                if (!choice || choice->maxSquare != best->maxSquare || choice->cellCount != best->cellCount) ++mismatches;
+            }
+        }
+        const double replay = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / reps;
+        std::printf("final %dx%d (%d players): %zu cells, solver %.1f us, replay per cell %.1f us%s\n",
+                    position.rows(), position.cols(), numPlayers, candidates / reps, solver, replay,
+                    mismatches ? " (MISMATCH)" : "");
+    }
+}
+
+/**
+ * @brief Voronoï de référence : parcours en largeur case par case (file, distance et
+ *        propriétaire par case ; une case disputée n’est pas propagée).
+ */
+Territory scalarTerritory(const Position& pos) {
+    const int rows = pos.rows(), cols = pos.cols(), seats = pos.numSeats();
+    constexpr int kContested = -2;
+    std::vector<int> dist(rows * cols, -1), owner(rows * cols, -1);
+    std::vector<int> level;
+    for (int s = 0; s < seats; ++s)
+        for (int y = 0; y < rows; ++y)
+            for (int x = 0; x < cols; ++x)
+                if ((pos.owned(s)[y] >> x) & 1u) { dist[y * cols + x] = 0; owner[y * cols + x] = s; level.push_back(y * cols + x); }
+    Territory t;
+    for (int d = 0; !level.empty(); ++d) {
+        std::vector<int> next;
+        for (int c : level) {
+            const int s = owner[c];
+            if (s == kContested) continue;
+            const PlacementMasks masks = pos.masks(s);
+            const int cx = c % cols, cy = c / cols;
+            const int nx[4] = {cx - 1, cx + 1, cx, cx}, ny[4] = {cy, cy, cy - 1, cy + 1};
+            for (int k = 0; k < 4; ++k) {
+                if (nx[k] < 0 || ny[k] < 0 || nx[k] >= cols || ny[k] >= rows) continue;
+                if (!((masks.free[ny[k]] >> nx[k]) & 1u)) continue;
+                const int n = ny[k] * cols + nx[k];
+                if (dist[n] == -1) { dist[n] = d + 1; owner[n] = s; next.push_back(n); }
+                else if (dist[n] == d + 1 && owner[n] != s && owner[n] != kContested) owner[n] = kContested;
+            }
+        }
+        if (!next.empty()) t.steps = d + 1;
+        level.swap(next);
+    }
+    for (int c = 0; c < rows * cols; ++c) {
+        if (dist[c] <= 0) continue;
+        if (owner[c] == kContested) t.contested[c / cols] |= Row(1) << (c % cols);
+        else { t.region[owner[c]][c / cols] |= Row(1) << (c % cols); ++t.area[owner[c]]; }
+    }
+    return t;
+}
+
+/**
+ * @brief Potentiel territorial (Territory) à 4 et 9 joueurs, en début et en milieu de
+ *        partie, comparé au parcours case par case.
+ */
+void benchTerritory(const std::vector<ShapeSet>& shapes) {
+    for (int numPlayers : {4, 9}) {
+        const std::vector<Player> players = benchPlayers(numPlayers);
+        for (int round : {1, 5}) {
+            std::mt19937 rng(7 + round);
+            const Position position = searchPosition(players, round, shapes, rng);
+            const int reps = 2000;
+            int steps = 0;
+            auto t0 = std::chrono::steady_clock::now();
+            for (int r = 0; r < reps; ++r) steps += Territory::compute(position).steps;
+            const double sweep = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / reps;
+
+            Territory reference;
+            t0 = std::chrono::steady_clock::now();
+            for (int r = 0; r < reps / 20; ++r) reference = scalarTerritory(position);
+            const double scalar = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / (reps / 20);
+
+            const Territory t = Territory::compute(position);
+            bool same = t.steps == reference.steps && t.contested == reference.contested;
+            for (int s = 0; s < numPlayers; ++s) same = same && t.region[s] == reference.region[s];
+            std::printf("territory %dx%d (%d players, round %d): %d steps, sweep %.2f us, scalar BFS %.2f us%s\n",
+                        position.rows(), position.cols(), numPlayers, round, steps / reps, sweep, scalar,
+                        same ? "" : " (MISMATCH)");
+        }
+    }
+}
+
+/**
+ * @brief Carte de couverture (Coverage) à 9 joueurs sur 30x30 : calcul complet, puis mise
+ *        à jour après chaque pose d’une partie aléatoire, pour une tuile et pour le catalogue ;
+ *        la carte mise à jour est comparée à un recalcul complet en fin de partie.
+ */
+void benchCoverage(const std::vector<ShapeSet>& shapes) {
+    const std::vector<Player> players = benchPlayers(9);
+    for (bool catalog : {false, true}) {
+        std::mt19937 rng(99);
+        Position position = searchPosition(players, 1, shapes, rng);
+        Coverage coverage(catalog ? shapes : std::vector<ShapeSet>{shapes[0]});
+        auto t0 = std::chrono::steady_clock::now();
+        coverage.compute(position);
+        const double full = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+
+        MoveList moves;
+        double updates = 0.0;
+        int placed = 0;
+        for (int t = 0; t < 8 * 9; ++t) {
+            const int seat = t % 9;
+            const ShapeSet& s = shapes[rng() % shapes.size()];
+            MoveGenerator::generate(position.masks(seat), s, moves);
+            if (moves.empty()) continue;
+            const Move& m = moves[rng() % moves.size()];
+            position.place(seat, s.orientations()[m.orientation], m.x, m.y);
+            t0 = std::chrono::steady_clock::now();
+            coverage.update(position);
+            updates += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+            ++placed;
+        }
+        Coverage reference(catalog ? shapes : std::vector<ShapeSet>{shapes[0]});
+        reference.compute(position);
+        bool same = true;
+        for (int seat = 0; seat < 9; ++seat) same = same && coverage.grid(seat) == reference.grid(seat);
+        std::printf("coverage 30x30 (9 players, %s): full %.1f us, update %.1f us per placement%s\n",
+                    catalog ? "catalog" : "one tile", full, updates / std::max(placed, 1), same ? "" : " (MISMATCH)");
+    }
+}
+
+/**
+ * @brief Aide aux origines (Game::showOrigins) sur 30x30 à 9 joueurs : pour chaque tuile du
+ *        catalogue et chacune de ses 8 transformations (r / f), orientation courante,
+ *        masques du plateau, origines légales et grille de marques, comme à chaque
+ *        rafraîchissement ; pire cas comparé à une image à 60 Hz.
+ */
+void benchOriginHints(const InitTiles& catalog, const std::vector<ShapeSet>& shapes) {
+    std::mt19937 rng(2024);
+    const Board board = randomPosition(9, 3 * 9, shapes, rng);
+    double total = 0.0, worst = 0.0;
+    std::size_t refreshes = 0, origins = 0;
+    for (int pid = 1; pid <= 9; ++pid) {
+        for (Tile tile : catalog.all()) {
+            for (int step = 0; step < 8; ++step) {
+                if (step == 4) tile.flip();
+                else if (step > 0) tile.rotate();
+                const auto t0 = Clock::now();
+                const ShapeSet shape(tile);
+                const BitGrid legal = MoveGenerator::legalOrigins(MoveGenerator::masksFor(board, pid),
+                                                                  shape.orientations()[shape.indexOf(0, false)]);
+                std::vector<std::vector<char>> marks(board.getRows(), std::vector<char>(board.getCols(), '\0'));
+                for (int y = 0; y < board.getRows(); ++y)
+                    for (Row r = legal[y]; r; r &= r - 1) { marks[y][lowestBit(r)] = 'o'; ++origins; }
+                const double dt = secondsSince(t0);
+                total += dt;
+                worst = std::max(worst, dt);
+                ++refreshes;
+            }
+        }
+    }
+    std::printf("origin hints %dx%d (9 players): %zu refreshes, %.1f us average, %.1f us worst "
+                "(%.3f%% of a 16.7 ms frame), %zu origins\n",
+                board.getRows(), board.getCols(), refreshes, 1e6 * total / refreshes, 1e6 * worst,
+                100.0 * worst / (1.0 / 60.0), origins);
+}
+
+/**
+ * @brief Validation groupée (BatchLegality) de la tuile en main et de 5 tuiles d’aperçu,
+ *        pour chaque joueur, comparée à MoveGenerator::legalOrigins orientation par orientation.
+ */
+void benchBatchLegality(const std::vector<ShapeSet>& shapes) {
+    for (int numPlayers : {4, 9}) {
+        std::mt19937 rng(31337);
+        const Board board = randomPosition(numPlayers, 3 * numPlayers, shapes, rng);
+        const int reps = 400;
+        double seconds[2] = {0.0, 0.0};
+        std::size_t orientations = 0, mismatches = 0;
+        for (int window = 0; window < 50; ++window) {
+            BatchLegality batch;
+            std::vector<const ShapeSet*> tiles;
+            for (int i = 0; i < 6; ++i) {
+                tiles.push_back(&shapes[rng() % shapes.size()]);
+                batch.add(*tiles.back());
+            }
+            for (int pid = 1; pid <= numPlayers; ++pid) {
+                const PlacementMasks masks = MoveGenerator::masksFor(board, pid);
+                auto t0 = Clock::now();
+                for (int r = 0; r < reps; ++r) batch.run(masks);
+                seconds[0] += secondsSince(t0);
+                Row sink = 0;
+                t0 = Clock::now();
+                for (int r = 0; r < reps; ++r)
+                    for (const ShapeSet* s : tiles)
+                        for (const Orientation& o : s->orientations()) sink ^= MoveGenerator::legalOrigins(masks, o)[0];
+                seconds[1] += secondsSince(t0) + (sink == Row(-1) ? 1e-12 : 0.0);
+                for (int i = 0; i < 6; ++i) {
+                    const auto& orients = tiles[i]->orientations();
+                    if (pid == 1) orientations += orients.size();
+                    for (std::size_t o = 0; o < orients.size(); ++o)
+                        if (batch.origins(i, static_cast<int>(o)) != MoveGenerator::legalOrigins(masks, orients[o])) ++mismatches;
+                }
+            }
+        }
+        const double calls = 50.0 * numPlayers * reps;
+        std::printf("batch legality %dx%d (%d players, %.1f orientations): batch %.2f us, per orientation %.2f us%s\n",
+                    board.getRows(), board.getCols(), numPlayers, orientations / 50.0,
+                    1e6 * seconds[0] / calls, 1e6 * seconds[1] / calls, mismatches ? " (MISMATCH)" : "");
+    }
+}
+
+/**
+ * @brief Politiques HeuristicPolicy : décisions par seconde en milieu de partie, puis
+ *        récompense moyenne du siège 0 (part des adversaires battus) quand il suit la
+ *        politique et les autres sièges jouent au hasard (0.5 : pas mieux que le hasard).
+ */
+void benchHeuristics(const std::vector<ShapeSet>& shapes) {
+    using Kind = HeuristicPolicy::Kind;
+    const Kind kinds[] = { Kind::Random, Kind::GreedySquare, Kind::BonusSeeker, Kind::Blocker };
+    for (int numPlayers : {4, 9}) {
+        const std::vector<Player> players = benchPlayers(numPlayers);
+        std::mt19937 rng(2718);
+        std::vector<Position> positions;
+        for (int i = 0; i < 64; ++i) {
+            Position p = searchPosition(players, 4, shapes, rng);
+            while (p.toMove() != i % numPlayers) p.endTurn();
+            positions.push_back(p);
+        }
+        MoveList scratch;
+        {
+            const int reps = 20000;
+            std::size_t sink = 0;
+            const auto t0 = Clock::now();
+            for (int r = 0; r < reps; ++r) {
+                const Position& p = positions[r % positions.size()];
+                MoveGenerator::generate(p.masks(p.toMove()), shapes[r % shapes.size()], scratch);
+                if (!scratch.empty()) sink += scratch[rng() % scratch.size()].x;
+            }
+            std::printf("heuristic reference     %dx%d (%d players): %.0f decisions/s (generate + uniform pick)%s\n",
+                        positions[0].rows(), positions[0].cols(), numPlayers, reps / secondsSince(t0),
+                        sink == std::size_t(-1) ? " " : "");
+        }
+        for (Kind kind : kinds) {
+            const HeuristicPolicy policy(kind);
+            const int reps = 20000;
+            int placed = 0;
+            const auto t0 = Clock::now();
+            for (int r = 0; r < reps; ++r) {
+                const Position& p = positions[r % positions.size()];
+                Move m;
+                placed += policy.choose(p, p.toMove(), shapes[r % shapes.size()], rng, m);
+            }
+            const double dt = secondsSince(t0);
+
+            const int games = 200;
+            double reward = 0.0;
+            const HeuristicPolicy randomPolicy(Kind::Random);
+            for (int g = 0; g < games; ++g) {
+                Position pos = searchPosition(players, 1, shapes, rng);
+                while (!pos.roundsOver()) {
+                    const int seat = pos.toMove();
+                    pos.clearRock(seat);
+                    const ShapeSet& shape = shapes[rng() % shapes.size()];
+                    Move m;
+                    if ((seat == 0 ? policy : randomPolicy).choose(pos, seat, shape, rng, m))
+                        pos.place(seat, shape.orientations()[m.orientation], m.x, m.y);
+                    pos.endTurn();
+                }
+                std::array<float, kMaxPlayers> r{};
+                pos.rewards(r);
+                reward += r[0];
+            }
+            std::printf("heuristic %-13s %dx%d (%d players): %.0f decisions/s (%.1f%% placed), reward vs random %.2f\n",
+                        HeuristicPolicy::name(kind), positions[0].rows(), positions[0].cols(), numPlayers,
+                        reps / dt, 100.0 * placed / reps, reward / games);
+        }
+    }
+}
+
+/**
+ * @brief Débit de Playout (parties simulées par seconde, manche 1 puis 4 jusqu’à la fin,
+ *        pioche déterminisée comme dans MctsAgent), comparé à la même partie jouée par
+ *        HeuristicPolicy (aléatoire) et std::mt19937.
+ */
+void benchPlayout(const InitTiles& catalog, const std::vector<ShapeSet>& shapes) {
+    const Playout playout(shapes);
+    const HeuristicPolicy policy;
+    for (int numPlayers : {4, 9}) {
+        const std::vector<Player> players = benchPlayers(numPlayers);
+        TileQueue queue;
+        queue.setSamplingMode(TileQueue::SamplingMode::WeightedShuffle);
+        queue.initFrom(catalog, true, 99);
+        const TileBag bag = TileBag::fromQueue(queue, queue.weights());
+        for (int round : {1, 4}) {
+            std::mt19937 rng(777);
+            const Position start = searchPosition(players, round, shapes, rng);
+            const double budget = 0.5;
+
+            FastRng fast(1);
+            std::size_t games = 0;
+            long cells = 0;
+            auto t0 = Clock::now();
+            while (secondsSince(t0) < budget) {
+                for (int i = 0; i < 64; ++i, ++games) {
+                    Position pos = start;
+                    TileBag b = bag;
+                    b.determinize(fast);
+                    const auto scores = playout.run(pos, b, b.draw(fast), fast);
+                    cells += scores[0].cellCount;
+                }
+            }
+            const double fastRate = games / secondsSince(t0);
+            const double fastCells = double(cells) / games;
+
+            games = 0;
+            cells = 0;
+            t0 = Clock::now();
+            while (secondsSince(t0) < budget) {
+                for (int i = 0; i < 64; ++i, ++games) {
+                    Position pos = start;
+                    TileBag b = bag;
+                    b.determinize(rng);
+                    for (int tile = b.draw(rng); !pos.roundsOver(); tile = b.draw(rng)) {
+                        const int seat = pos.toMove();
+                        pos.clearRock(seat);
+                        Move m;
+                        if (policy.choose(pos, seat, shapes[tile], rng, m))
+                            pos.place(seat, shapes[tile].orientations()[m.orientation], m.x, m.y);
+                        pos.endTurn();
+                    }
+                    cells += pos.score(0).cellCount;
+                }
+            }
+            std::printf("playout %dx%d (%d players, from round %d): %.0f playouts/s (%.1f cells), "
+                        "policy + mt19937 %.0f playouts/s (%.1f cells)\n",
+                        start.rows(), start.cols(), numPlayers, round, fastRate, fastCells,
+                        games / secondsSince(t0), double(cells) / games);
+        }
+    }
+}
+
+void benchSimd(const InitTiles& catalog, const std::vector<ShapeSet>& shapes) {
+    const Playout playout(shapes);
+    BatchPlayout batch(shapes);
+    for (int numPlayers : {4, 9}) {
+        const std::vector<Player> players = benchPlayers(numPlayers);
+        TileQueue queue;
+        queue.setSamplingMode(TileQueue::SamplingMode::WeightedShuffle);
+        queue.initFrom(catalog, true, 99);
+        const TileBag bag = TileBag::fromQueue(queue, queue.weights());
+        std::mt19937 rng(777);
+        const Position start = searchPosition(players, 1, shapes, rng);
+        const double budget = 0.5;
+
+        FastRng fast(1);
+        std::size_t games = 0;
+        auto t0 = Clock::now();
+        while (secondsSince(t0) < budget) {
+            for (int i = 0; i < 64; ++i, ++games) {
+                Position pos = start;
+                TileBag b = bag;
+                b.determinize(fast);
+                playout.run(pos, b, b.draw(fast), fast);
+            }
+        }
+        const double serial = games / secondsSince(t0);
+
+        // Parties d’un groupe corrélées (tuiles communes) : débits divisés par l’effet de plan.
+        const std::vector<Position> starts(256, start);
+        std::vector<std::array<SeatScore, kMaxPlayers>> scores;
+        double rates[2] = { 0.0, 0.0 };
+        double sum = 0.0, sumSq = 0.0, groupSumSq = 0.0;
+        std::size_t groups = 0;
+        for (int avx2 = 0; avx2 < 2; ++avx2) {
+            batch.setAvx2(avx2 != 0);
+            if (avx2 && !batch.avx2()) break;
+            games = 0;
+            t0 = Clock::now();
+            while (secondsSince(t0) < budget) {
+                batch.run(starts, bag, fast, scores);
+                games += starts.size();
+                for (std::size_t g = 0; g < scores.size(); g += kBatchLanes, ++groups) {
+                    double mean = 0.0;
+                    for (int l = 0; l < kBatchLanes; ++l) {
+                        const double v = scores[g + l][0].maxSquare;
+                        sum += v;
+                        sumSq += v * v;
+                        mean += v / kBatchLanes;
+                    }
+                    groupSumSq += mean * mean;
+                }
+            }
+            rates[avx2] = games / secondsSince(t0);
+        }
+        const double samples = double(groups) * kBatchLanes, mean = sum / samples;
+        const double variance = sumSq / samples - mean * mean;
+        const double groupVariance = groupSumSq / groups - mean * mean;
+        const double designEffect = variance > 0.0 ? std::max(1.0, groupVariance * kBatchLanes / variance) : 1.0;
+        std::printf("simd %dx%d (%d players): serial %.0f playouts/s, batch scalar %.0f playouts/s, "
+                    "batch avx2 %.0f playouts/s; lanes correlated (design effect %.2f): "
+                    "%.0f / %.0f independent playouts/s (x%.2f / x%.2f)\n",
+                    start.rows(), start.cols(), numPlayers, serial, rates[0], rates[1], designEffect,
+                    rates[0] / designEffect, rates[1] / designEffect,
+                    rates[0] / designEffect / serial, rates[1] / designEffect / serial);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const char* filter = argc > 1 ? argv[1] : "";
+    InitTiles catalog("Shapes.json");
+    if (catalog.all().empty()) {
+        std::fprintf(stderr, "Error : cannot load Shapes.json\n");
+        return 1;
+    }
+    std::vector<ShapeSet> shapes;
+    for (const auto& t : catalog.all()) shapes.emplace_back(t);
+
+    auto wanted = [&](const char* name) { return std::strstr(name, filter) != nullptr; };
+    if (wanted("movegen")) benchMoveGeneration(shapes);
+    if (wanted("movecache")) benchPlacementCache(shapes);
+    if (wanted("mcts")) benchMcts(catalog, shapes);
+    if (wanted("mcts-threads")) benchMctsThreads(catalog, shapes);
+    if (wanted("ismcts")) benchIsmcts(catalog, shapes);
+    if (wanted("alphabeta")) benchAlphaBeta(catalog, shapes);
+    if (wanted("deadline")) benchDeadline(catalog, shapes);
+    if (wanted("exchange")) benchExchangeAdvisor(catalog, shapes);
+    if (wanted("stone")) benchStoneAdvisor(shapes);
+    if (wanted("final")) benchFinalCell(shapes);
+    if (wanted("territory")) benchTerritory(shapes);
+    if (wanted("coverage")) benchCoverage(shapes);
+    if (wanted("origins")) benchOriginHints(catalog, shapes);
+    if (wanted("batch")) benchBatchLegality(shapes);
+    if (wanted("heuristics")) benchHeuristics(shapes);
+    if (wanted("playout")) benchPlayout(catalog, shapes);
+    if (wanted("simd")) benchSimd(catalog, shapes);
+    return 0;
+}
@@ -0,0 +1,235 @@
+/**
+* @file book.cpp
+ * @brief Construction du livre d’ouvertures (OpeningBook) par simulation de masse
+ *        (à compiler en Release).
+ *
+ * Usage : `book [parties] [fichier]` — 20000 parties simulées par position et
+ * `openings.book` par défaut.
+ *
+ * Pour chaque nombre de joueurs (2 à 9), la ligne principale de la phase de départ est
+ * construite siège par siège : toutes les cases libres du siège qui place sa case (une par
+ * classe de symétrie) sont évaluées par parties simulées. Chaque partie tire une disposition
+ * de bonus où ces cases ne sont pas des bonus, place les cases suivantes avec la règle par
+ * défaut d’Agent::chooseStart, puis est jouée par Playout ; la valeur d’une case est le
+ * résultat moyen du siège (Position::rewards). Les parties sont réparties par élimination
+ * successive (la moitié des cases est écartée à chaque tour, le budget des suivants est
+ * partagé entre les restantes) et sur tous les cœurs. Les 4 meilleures cases sont
+ * enregistrées, puis la meilleure est jouée et le siège suivant est évalué.
+ *
+ * Le livre ne dépend que des arguments, pas du nombre de cœurs : les dispositions de bonus
+ * sont tirées d’un générateur à graine fixe et les parties d’une case, d’un générateur dont
+ * la graine ne dépend que de la case, du siège, du nombre de joueurs et du tour.
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include "AI/HeuristicAgent.hpp"
+#include "AI/OpeningBook.hpp"
+#include "Board/Board.hpp"
+#include "Engine/FastRng.hpp"
+#include "Engine/Playout.hpp"
+#include "Engine/Position.hpp"
+#include "Engine/Shape.hpp"
+#include "Engine/TileBag.hpp"
+#include "Player/Player.hpp"
+#include "Tile/InitTiles.hpp"
+#include "Tile/TileQueue.hpp"
+
+namespace {
+
+/// Dispositions de bonus tirées par nombre de joueurs.
+constexpr int kLayouts = 64;
+
+/**
+ * @struct Candidate
+ * @brief Case de départ évaluée et somme de ses résultats.
+ */
+struct Candidate {
+    int x = 0;
+    int y = 0;
+    double sum = 0.0;
+    int samples = 0;
+
+    double mean() const { return samples ? sum / samples : 0.0; }
+};
+
+/**
+ * @brief Exécute body(i) pour chaque i de [0, n) sur `threads` fils, indices distribués un à
+ *        un ; chaque appel ne doit écrire que dans sa propre case de résultat.
+ */
+template <class Body>
+void parallelFor(int threads, std::size_t n, Body body) {
+    std::atomic<std::size_t> next{ 0 };
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back([&] {
+            for (std::size_t i; (i = next.fetch_add(1)) < n;) body(i);
+        });
+    }
+    for (auto& th : pool) th.join();
+}
+
+/**
+ * @struct Simulator
+ * @brief Parties simulées d’une case de départ depuis une phase de départ partielle.
+ */
+struct Simulator {
+    const std::vector<Position>& layouts;
+    const TileBag& bag;
+    const Playout& playout;
+    std::mt19937 rng;
+    FastRng fast;
+    HeuristicAgent starter;
+
+    /**
+     * @brief Résultat du siège `starts.size()` après une partie où il part de (x, y).
+     * @return false si aucune disposition tirée ne laisse ces cases libres.
+     */
+    bool play(const std::vector<std::pair<int,int>>& starts, int x, int y, float& reward) {
+        for (int attempt = 0; attempt < 16; ++attempt) {
+            Position pos = layouts[rng() % layouts.size()];
+            bool free = pos.isEmpty(x, y) && !pos.isBonus(x, y);
+            for (auto [sx, sy] : starts) free = free && pos.isEmpty(sx, sy) && !pos.isBonus(sx, sy);
+            if (!free) continue;
+
+            const int seat = static_cast<int>(starts.size());
+            for (int s = 0; s < seat; ++s) pos.placeCell(s, starts[s].first, starts[s].second);
+            pos.placeCell(seat, x, y);
+            for (int s = seat + 1; s < pos.numSeats(); ++s) {
+                const auto [cx, cy] = starter.chooseStart(pos, s);
+                pos.placeCell(s, cx, cy);
+            }
+            TileBag b = bag;
+            b.determinize(rng);
+            const int tile = b.draw(rng);
+            std::array<float, kMaxPlayers> rewards{};
+            Position::rewards(playout.run(pos, b, tile, fast), pos.numSeats(), rewards);
+            reward = rewards[seat];
+            return true;
+        }
+        return false;
+    }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int budget = argc > 1 ? std::max(100, std::atoi(argv[1])) : 20000;
+    const std::string output = argc > 2 ? argv[2] : "openings.book";
+    const int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    InitTiles catalog("Shapes.json");
+    if (catalog.all().empty()) {
+        std::fprintf(stderr, "Error : cannot load Shapes.json\n");
+        return 1;
+    }
+    std::vector<ShapeSet> shapes;
+    for (const auto& t : catalog.all()) shapes.emplace_back(t);
+    const Playout playout(shapes);
+    TileQueue queue;
+    queue.setSamplingMode(TileQueue::SamplingMode::WeightedShuffle);
+    queue.initFrom(catalog, true, 7);
+    const TileBag bag = TileBag::fromQueue(queue, queue.weights());
+
+    std::vector<BookEntry> entries;
+    std::size_t games = 0;
+    for (int n = 2; n <= kMaxPlayers; ++n) {
+        // Plateaux construits sur ce fil (Board et Player ne sont pas réentrants).
+        std::vector<Player> players;
+        for (int p = 0; p < n; ++p) players.emplace_back("p" + std::to_string(p), "red");
+        std::vector<Position> layouts;
+        std::mt19937 layoutRng(4049u + n);
+        for (int i = 0; i < kLayouts; ++i) {
+            Board board(n);
+            board.placeBonus(n, layoutRng);
+            layouts.push_back(Position::fromBoard(board, players, 1, 0));
+        }
+        const Position bare = Position::fromBoard(Board(n), players, 1, 0);
+        const int side = bare.rows();
+
+        std::vector<std::pair<int,int>> starts;
+        for (int seat = 0; seat < n; ++seat) {
+            Position node = bare;
+            for (int s = 0; s < seat; ++s) node.placeCell(s, starts[s].first, starts[s].second);
+            OpeningBook::Key key;
+            OpeningBook::keyOf(node, seat, key);
+
+            // Une case par classe de symétrie de la position obtenue.
+            std::vector<Candidate> candidates;
+            std::set<std::uint64_t> seen;
+            for (int y = 0; y < side; ++y) {
+                for (int x = 0; x < side; ++x) {
+                    if (!node.isEmpty(x, y)) continue;
+                    Position next = node;
+                    next.placeCell(seat, x, y);
+                    OpeningBook::Key k;
+                    OpeningBook::keyOf(next, seat + 1, k);
+                    if (seen.insert(k.hash).second) candidates.push_back({ x, y });
+                }
+            }
+
+            // Élimination successive : budget partagé également entre les tours.
+            const int rounds = 1 + static_cast<int>(std::ceil(std::log2(std::max(1.0, double(candidates.size()) / kBookMoves))));
+            std::vector<Candidate> alive = candidates;
+            std::uint32_t played = 0;
+            for (int r = 0; r < rounds; ++r) {
+                const int each = std::max(1, budget / rounds / static_cast<int>(alive.size()));
+                parallelFor(threads, alive.size(), [&](std::size_t i) {
+                    const unsigned cell = static_cast<unsigned>(alive[i].y * side + alive[i].x);
+                    Simulator sim{ layouts, bag, playout,
+                                   std::mt19937(7919u * (seat + 1) + 131u * n + 17u * r + 1000003u * cell),
+                                   FastRng(1000003ull * n + 1009ull * seat + 31ull * r + (std::uint64_t(cell) << 32)),
+                                   HeuristicAgent(HeuristicAgent::Config{ HeuristicPolicy::Kind::Random, 1 }) };
+                    for (int g = 0; g < each; ++g) {
+                        float reward;
+                        if (!sim.play(starts, alive[i].x, alive[i].y, reward)) break;
+                        alive[i].sum += reward;
+                        ++alive[i].samples;
+                    }
+                });
+                std::stable_sort(alive.begin(), alive.end(),
+                                 [](const Candidate& a, const Candidate& b) { return a.mean() > b.mean(); });
+                const std::size_t keep = r + 1 < rounds ? std::max<std::size_t>(kBookMoves, (alive.size() + 1) / 2)
+                                                        : alive.size();
+                for (std::size_t i = 0; i < alive.size(); ++i)
+                    if (i >= keep || r + 1 == rounds) played += static_cast<std::uint32_t>(alive[i].samples);
+                if (keep < alive.size()) alive.resize(keep);
+            }
+            games += played;
+
+            BookEntry entry;
+            entry.key = key.hash;
+            entry.count = static_cast<std::uint8_t>(std::min<std::size_t>(kBookMoves, alive.size()));
+            for (int m = 0; m < entry.count; ++m) {
+                int x = alive[m].x, y = alive[m].y;
+                OpeningBook::transform(key.symmetry, false, side, x, y);
+                const double share = std::clamp(alive[m].mean(), 0.0, 1.0);
+                entry.moves[m] = { static_cast<std::uint8_t>(x), static_cast<std::uint8_t>(y),
+                                   static_cast<std::uint16_t>(std::lround(share * 65535.0)) };
+            }
+            entry.samples = played;
+            entries.push_back(entry);
+            std::printf("%d players, seat %d: %zu cells, best (%d, %d) %.1f%% over %d games\n",
+                        n, seat + 1, candidates.size(), alive[0].x, alive[0].y,
+                        100.0 * alive[0].mean(), alive[0].samples);
+            std::fflush(stdout);
+            starts.emplace_back(alive[0].x, alive[0].y);
+        }
+    }
+
+    if (!OpeningBook::save(output, entries)) {
+        std::fprintf(stderr, "Error : cannot write %s\n", output.c_str());
+        return 1;
+    }
+    std::printf("%zu positions from %zu simulated games written to %s\n", entries.size(), games, output.c_str());
+    return 0;
+}
@@ -0,0 +1,161 @@
+#ifndef AGENT_HPP_INCLUDED
+#define AGENT_HPP_INCLUDED
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+#include "AI/OpeningBook.hpp"
+#include "AI/SearchLimits.hpp"
+#include "Engine/MoveGenerator.hpp"
+#include "Engine/Position.hpp"
+#include "Engine/Shape.hpp"
+#include "Engine/TileBag.hpp"
+
+/**
+ * @struct TurnContext
+ * @brief Ce qu’un joueur ordinateur sait au moment de jouer sa tuile.
+ *
+ * Uniquement de l’information publique : le plateau, les joueurs, la tuile en main,
+ * la fenêtre d’aperçu et la composition restante de la pioche (TileBag).
+ */
+struct TurnContext {
+    /// État de la partie ; le siège qui joue est `position.toMove()`.
+    const Position& position;
+    /// Vue publique de la pioche (fenêtre + composition cachée).
+    const TileBag& bag;
+    /// Orientations de chaque tuile du catalogue (même indice que InitTiles::all()).
+    const std::vector<ShapeSet>& catalog;
+    /// Indice de catalogue de la tuile en main.
+    int tile;
+};
+
+/**
+ * @struct TurnDecision
+ * @brief Décision d’un tour : échange éventuel, puis pose ou abandon de la tuile.
+ */
+struct TurnDecision {
+    /// Indice dans la fenêtre de la tuile prise en échange (-1 : pas d’échange).
+    int exchangeSlot = -1;
+    /// Indice de catalogue de la tuile posée (après échange éventuel).
+    int tile = -1;
+    /// Vrai si la tuile n’est pas posée (aucun placement légal, ou choix du joueur).
+    bool pass = true;
+    /// Placement (orientation dans catalog[tile], origine).
+    Move move{};
+};
+
+/**
+ * @struct BudgetUsage
+ * @brief Consommation du budget de temps par la dernière décision de tour.
+ */
+struct BudgetUsage {
+    /// Temps accordé (secondes entre l’appel et l’échéance).
+    double budget = 0.0;
+    /// Temps effectivement passé dans la décision.
+    double used = 0.0;
+    /// Dépassement de l’échéance (0 si la décision est rendue à temps).
+    double overrun = 0.0;
+    /// Vrai si la décision a été annulée avant l’échéance.
+    bool cancelled = false;
+};
+
+/**
+ * @class Agent
+ * @brief Interface d’un joueur ordinateur.
+ *
+ * Game consulte l’agent à chaque décision d’un siège tenu par l’ordinateur : case de départ,
+ * pierre du Rock bonus, tour de jeu et case 1x1 finale. Seul search() est abstrait ;
+ * les autres décisions ont une implémentation heuristique simple, redéfinissable.
+ *
+ * Une décision de tour est « à tout moment » : elle reçoit une échéance et un jeton
+ * d’annulation (SearchLimits), garde toujours un meilleur coup provisoire et le rend
+ * dès que l’une des deux limites est atteinte. decideTurn() mesure la consommation
+ * du budget (lastBudget()).
+ */
+class Agent {
+public:
+    virtual ~Agent() = default;
+
+    /** @brief Nom affiché de l’agent (ex. "MCTS"). */
+    virtual std::string name() const = 0;
+
+    /**
+     * @brief Choisit l’action du tour (échange, orientation, origine ou abandon).
+     * @param ctx Situation du siège qui joue.
+     * @param limits Échéance et jeton d’annulation.
+     * @return Décision ; un placement renvoyé doit être légal.
+     */
+    TurnDecision decideTurn(const TurnContext& ctx, const SearchLimits& limits);
+
+    /** @brief Choisit l’action du tour avec le budget par défaut de l’agent (defaultSeconds()). */
+    TurnDecision decideTurn(const TurnContext& ctx) { return decideTurn(ctx, SearchLimits::within(defaultSeconds())); }
+
+    /** @brief Budget de temps d’une décision quand aucune échéance n’est donnée. */
+    virtual double defaultSeconds() const { return 1.0; }
+
+    /** @brief Consommation du budget par la dernière décision de tour. */
+    const BudgetUsage& lastBudget() const { return budget_; }
+
+    /**
+     * @brief Résumé de la dernière décision (statistiques de recherche), vide par défaut.
+     */
+    virtual std::string lastReport() const { return {}; }
+
+    /**
+     * @brief Choisit la case de départ du siège.
+     *
+     * Par défaut : le meilleur coup du livre d’ouvertures (setOpeningBook) sur une case vide
+     * hors bonus s’il y en a un, sinon la case vide (hors bonus) la plus éloignée des
+     * territoires déjà posés, en évitant les bords.
+     *
+     * @param position Position courante.
+     * @param seat Siège qui place sa case.
+     * @return Coordonnées (x, y) d’une case vide.
+     */
+    virtual std::pair<int,int> chooseStart(const Position& position, int seat);
+
+    /**
+     * @brief Choisit où poser la pierre du Rock bonus.
+     *
+     * Par défaut : l’ancre de l’adversaire en tête qui touche le plus son territoire,
+     * sinon n’importe quelle case vide.
+     *
+     * @param position Position courante.
+     * @param seat Siège qui pose la pierre.
+     * @return Coordonnées (x, y), ou std::nullopt si aucune case n’est vide.
+     */
+    virtual std::optional<std::pair<int,int>> chooseStone(const Position& position, int seat);
+
+    /**
+     * @brief Choisit la case 1x1 de la phase finale (un coupon dépensé).
+     *
+     * Par défaut : le choix exact de FinalCellSolver (plus grand carré, puis cases).
+     *
+     * @param position Position courante.
+     * @param seat Siège qui achète la case.
+     * @return Coordonnées (x, y), ou std::nullopt pour ne pas acheter.
+     */
+    virtual std::optional<std::pair<int,int>> chooseFinalCell(const Position& position, int seat);
+
+    /**
+     * @brief Livre d’ouvertures consulté par chooseStart() (nullptr : aucun).
+     * @param book Livre, qui doit survivre à l’agent ou être retiré avant.
+     */
+    void setOpeningBook(const OpeningBook* book) { book_ = book; }
+
+protected:
+    /**
+     * @brief Recherche de la décision du tour, appelée par decideTurn().
+     *
+     * Doit consulter `limits.expired()` assez souvent pour rendre la main quelques
+     * millisecondes au plus après l’échéance, même si celle-ci est déjà passée à l’appel.
+     */
+    virtual TurnDecision search(const TurnContext& ctx, const SearchLimits& limits) = 0;
+
+private:
+    BudgetUsage budget_;
+    const OpeningBook* book_ = nullptr;
+};
+
+#endif // AGENT_HPP_INCLUDED
@@ -0,0 +1,202 @@
+#ifndef ALPHABETAAGENT_HPP_INCLUDED
+#define ALPHABETAAGENT_HPP_INCLUDED
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "AI/Agent.hpp"
+#include "AI/Evaluation.hpp"
+#include "Engine/Zobrist.hpp"
+
+/**
+ * @class AlphaBetaAgent
+ * @brief Joueur ordinateur déterministe : recherche alpha-bêta à profondeur limitée.
+ *
+ * À plus de deux joueurs, la réduction paranoïaque s’applique : tous les adversaires jouent
+ * ensemble contre le siège qui cherche (nœuds « min »), ce qui ramène max-n à un jeu à deux
+ * où l’élagage alpha-bêta reste valable.
+ *
+ * Les tirages ne sont connus que dans la fenêtre d’aperçu : la recherche s’arrête (évaluation)
+ * quand la tuile suivante sort de la fenêtre, sans rien supposer de l’ordre caché. Un pli est
+ * le tour d’un siège ; à la racine s’ajoutent les échanges contre un coupon.
+ *
+ * - approfondissement itératif (1, 2, … plis) dans le temps imparti, le meilleur coup de
+ *   l’itération précédente étant essayé en premier ;
+ * - table de transposition indexée par clé de Zobrist (bornes exacte / inférieure / supérieure
+ *   et meilleur coup), conservée d’une décision à l’autre, clé propre au siège racine ;
+ * - ordre des coups : coup de la table, deux coups « killer » par pli, heuristique
+ *   d’historique, puis a priori (contacts avec son territoire, taille de la tuile) ;
+ * - évaluation linéaire (Evaluation : plus grand carré, cases, ancres libres, bonus, …,
+ *   poids EvalWeights éventuellement réglés par l’outil `tune`) : siège qui cherche moins
+ *   le meilleur adversaire.
+ *
+ * Les nœuds par seconde et le facteur de branchement effectif (nœuds de la dernière
+ * itération / nœuds de la précédente) sont mesurés à chaque décision.
+ */
+class AlphaBetaAgent : public Agent {
+public:
+    /**
+     * @struct Config
+     * @brief Paramètres de recherche et poids de l’évaluation.
+     */
+    struct Config {
+        /// Profondeur maximale en plis (bornée en pratique par la fenêtre d’aperçu).
+        int maxDepth = 6;
+        /// Budget par défaut d’une décision, en secondes (decideTurn sans échéance).
+        double seconds = 1.0;
+        /// Entrées de la table de transposition (arrondi à une puissance de 2, 24 octets par entrée).
+        std::size_t tableEntries = std::size_t(1) << 19;
+        /// Considérer à la racine les échanges avec la fenêtre (si le siège a un coupon).
+        bool exchanges = true;
+        /// Poids de l’évaluation (un poids nul désactive le calcul de son critère).
+        EvalWeights weights;
+    };
+
+    /**
+     * @struct Stats
+     * @brief Statistiques de la dernière décision.
+     */
+    struct Stats {
+        /// Positions visitées (une par coup joué, feuilles comprises).
+        std::size_t nodes = 0;
+        double seconds = 0.0;
+        double nodesPerSecond = 0.0;
+        /// Dernière profondeur entièrement explorée.
+        int depth = 0;
+        /// Facteur de branchement effectif de la dernière itération.
+        double branching = 0.0;
+        std::size_t tableHits = 0;
+        std::size_t cutoffs = 0;
+        /// Évaluation du coup choisi.
+        int score = 0;
+    };
+
+    /** @brief Agent avec les paramètres par défaut. */
+    AlphaBetaAgent();
+
+    /** @brief Agent avec des paramètres donnés. */
+    explicit AlphaBetaAgent(Config config);
+
+    ~AlphaBetaAgent() override;
+
+    std::string name() const override { return "Alpha-beta"; }
+
+    double defaultSeconds() const override { return config_.seconds; }
+
+    std::string lastReport() const override;
+
+    /** @brief Statistiques de la dernière décision. */
+    const Stats& lastStats() const { return stats_; }
+
+    /** @brief Paramètres courants. */
+    const Config& config() const { return config_; }
+
+    /**
+     * @brief Évaluation statique du point de vue d’un siège (paranoïaque).
+     * @param pos Position évaluée.
+     * @param seat Siège qui cherche.
+     * @return Score du siège moins le meilleur score adverse (fin de partie : ± kWin en plus).
+     */
+    int evaluate(const Position& pos, int seat) const;
+
+protected:
+    TurnDecision search(const TurnContext& ctx, const SearchLimits& limits) override;
+
+private:
+    /// Coup « passer » (aucun placement légal).
+    static constexpr std::uint8_t kPass = 0xFF;
+    /// Borne des évaluations.
+    static constexpr int kInfinity = 1 << 30;
+    /// Écart d’une partie gagnée (toutes les récompenses de fin de partie le dépassent).
+    static constexpr int kWin = 1 << 24;
+
+    enum class Bound : std::uint8_t { None, Exact, Lower, Upper };
+
+    /**
+     * @struct Entry
+     * @brief Entrée de la table de transposition.
+     */
+    struct Entry {
+        std::uint64_t key = 0;
+        std::int32_t score = 0;
+        Move move{};
+        std::int8_t depth = -1;
+        Bound bound = Bound::None;
+    };
+
+    /**
+     * @struct Frame
+     * @brief Tampons d’un pli (coups générés, ordre), réutilisés d’un nœud à l’autre.
+     */
+    struct Frame {
+        MoveList moves;
+        std::vector<std::pair<int, std::uint16_t>> order;
+    };
+
+    /**
+     * @struct RootMove
+     * @brief Coup de la racine : case de fenêtre échangée (0 : aucune), tuile, placement, score.
+     */
+    struct RootMove {
+        std::uint8_t slot = 0;
+        int tile = -1;
+        Move move{};
+        int score = -kInfinity;
+    };
+
+    Config config_;
+    Stats stats_;
+    std::vector<Entry> table_;
+    std::vector<std::unique_ptr<Frame>> frames_;
+    /// Deux coups killer par pli.
+    std::vector<std::pair<Move, Move>> killers_;
+    /// Historique par camp (max / min), orientation et origine.
+    std::vector<int> history_;
+    /// Générateur passé aux tirages (la recherche ne tire que dans la fenêtre connue).
+    std::mt19937 rng_;
+
+    // État de la décision en cours.
+    const std::vector<ShapeSet>* catalog_ = nullptr;
+    int rootSeat_ = 0;
+    std::chrono::steady_clock::time_point start_;
+    const SearchLimits* limits_ = nullptr;
+    /// Limites expirées : l’itération en cours est abandonnée.
+    bool aborted_ = false;
+    /// Vrai si une feuille a été coupée par la profondeur (une itération de plus peut changer le résultat).
+    bool depthCut_ = false;
+
+    /**
+     * @brief Nœud de recherche : le siège à jouer pose `tile` (déjà tirée).
+     * @param board Clé de Zobrist des cases posées de `pos`.
+     * @param depth Plis restants.
+     * @param ply Distance à la racine.
+     * @return Valeur pour le siège qui cherche (échec doux : peut sortir de [alpha, beta]).
+     */
+    int search_(const Position& pos, const TileBag& bag, int tile, std::uint64_t board,
+                int depth, int ply, int alpha, int beta);
+
+    /**
+     * @brief Joue un coup puis cherche la suite (pierre éventuelle et tirage du siège suivant).
+     * @param slot 0 : tuile en main ; k > 0 : échange avec la (k-1)-ième tuile de la fenêtre.
+     * @return Valeur de la position obtenue ; évaluation statique si la tuile suivante est inconnue.
+     */
+    int play_(const Position& pos, const TileBag& bag, int tile, std::uint8_t slot, const Move& move,
+              std::uint64_t board, int depth, int ply, int alpha, int beta);
+
+    /**
+     * @brief Génère et ordonne les coups d’un nœud dans le tampon du pli.
+     */
+    Frame& orderMoves_(const Position& pos, int tile, int ply, const Move* tableMove);
+
+    /** @brief Indice d’historique d’un coup pour le camp (max / min) du siège. */
+    std::size_t historyIndex_(bool maximizing, const Move& move) const;
+
+    /** @brief Vérifie l’échéance et l’annulation (toutes les 64 visites). */
+    bool outOfTime_();
+};
+
+#endif // ALPHABETAAGENT_HPP_INCLUDED
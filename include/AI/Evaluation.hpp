@@ -0,0 +1,95 @@
+#ifndef EVALUATION_HPP_INCLUDED
+#define EVALUATION_HPP_INCLUDED
+
+#include <array>
+#include <string>
+#include "Engine/Position.hpp"
+#include "Engine/Territory.hpp"
+
+/**
+ * @enum EvalFeature
+ * @brief Critères de l’évaluation linéaire d’un siège (indices de EvalVector).
+ */
+enum class EvalFeature : int {
+    /// Côté du plus grand carré.
+    Square,
+    /// Cases possédées.
+    Cells,
+    /// Ancres (cases où le siège peut encore s’étendre).
+    Anchors,
+    /// Région Voronoï (Territory).
+    Territory,
+    /// Côtés déjà pris des bonus encore capturables.
+    Bonus,
+    /// Cases libres pour le siège à au plus deux pas de ses ancres.
+    Mobility,
+    /// Coupons d’échange.
+    Coupons
+};
+
+/// Nombre de critères.
+constexpr int kEvalFeatures = 7;
+
+/// Valeur de chaque critère (ou poids), dans l’ordre de EvalFeature.
+using EvalVector = std::array<int, kEvalFeatures>;
+
+/**
+ * @struct EvalWeights
+ * @brief Poids de l’évaluation linéaire, lus et écrits en JSON.
+ *
+ * Le fichier associe le nom de chaque critère à son poids ; les critères absents gardent
+ * leur valeur. Exemple :
+ * @code{.json}
+ * { "square": 1000, "cells": 10, "anchors": 2, "territory": 0,
+ *   "bonus": 0, "mobility": 0, "coupons": 0 }
+ * @endcode
+ * Les poids par défaut sont ceux d’AlphaBetaAgent avant réglage ; l’outil `tune` écrit des
+ * poids réglés par parties contre soi-même.
+ */
+struct EvalWeights {
+    EvalVector values{ 1000, 10, 2, 0, 0, 0, 0 };
+
+    int& operator[](EvalFeature f) { return values[static_cast<int>(f)]; }
+    int operator[](EvalFeature f) const { return values[static_cast<int>(f)]; }
+
+    /** @brief Nom d’un critère dans le fichier (ex. "square"). */
+    static const char* name(int feature);
+
+    /**
+     * @brief Charge des poids depuis un fichier JSON.
+     * @param path Chemin du fichier.
+     * @return false si le fichier est absent ou n’est pas un objet JSON (poids inchangés).
+     */
+    bool load(const std::string& path);
+
+    /**
+     * @brief Écrit les poids dans un fichier JSON.
+     * @return false si le fichier ne peut pas être écrit.
+     */
+    bool save(const std::string& path) const;
+};
+
+/**
+ * @class Evaluation
+ * @brief Critères d’un siège et évaluation linéaire (AlphaBetaAgent, outil de réglage).
+ */
+class Evaluation {
+public:
+    /**
+     * @brief Calcule tous les critères d’un siège.
+     * @param position Position évaluée.
+     * @param seat Siège.
+     * @param territory Régions Voronoï de la position (Territory::compute).
+     */
+    static EvalVector features(const Position& position, int seat, const Territory& territory);
+
+    /**
+     * @brief Somme pondérée des critères d’un siège.
+     *
+     * Seuls les critères de poids non nul sont calculés ; `territory` n’est lu que si le
+     * poids Territory est non nul (le pointeur peut être nul sinon).
+     */
+    static int score(const Position& position, int seat, const EvalWeights& weights, const Territory* territory);
+};
+
+#endif // EVALUATION_HPP_INCLUDED
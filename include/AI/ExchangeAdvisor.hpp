@@ -0,0 +1,69 @@
+#ifndef EXCHANGEADVISOR_HPP_INCLUDED
+#define EXCHANGEADVISOR_HPP_INCLUDED
+
+#include <vector>
+#include "AI/Agent.hpp"
+#include "Engine/BatchLegality.hpp"
+
+/**
+ * @class ExchangeAdvisor
+ * @brief Conseil d’échange : compare la tuile en main aux tuiles de la fenêtre d’aperçu.
+ *
+ * Pour chaque candidat (tuile en main, puis chaque tuile de la fenêtre), l’avis compte les
+ * placements légaux du siège qui joue et cherche le meilleur gain de score d’une pose
+ * (plus grand carré, puis cases). Les placements de tous les candidats sont validés en un
+ * seul balayage (BatchLegality) ; chaque pose est jouée sur une copie de la position
+ * (bonus capturés compris). Les candidats sont évalués en parallèle, un par fil au plus ;
+ * rank() rend la liste classée, meilleur candidat en tête.
+ */
+class ExchangeAdvisor {
+public:
+    /**
+     * @struct Option
+     * @brief Évaluation d’un candidat.
+     */
+    struct Option {
+        /// Indice dans la fenêtre (-1 : tuile en main, sans échange).
+        int slot = -1;
+        /// Indice de catalogue de la tuile.
+        int tile = -1;
+        /// Nombre de placements légaux (toutes orientations).
+        int placements = 0;
+        /// Gain de côté du plus grand carré de la meilleure pose.
+        int squareGain = 0;
+        /// Gain de cases de la meilleure pose.
+        int cellGain = 0;
+        /// Bonus capturés par la meilleure pose.
+        int bonuses = 0;
+        /// Meilleure pose (sans objet si placements == 0).
+        Move best{};
+    };
+
+    /**
+     * @brief Conseiller utilisant au plus `threads` fils (0 : un par cœur disponible).
+     */
+    explicit ExchangeAdvisor(int threads = 0);
+
+    /**
+     * @brief Classe la tuile en main et les tuiles de la fenêtre pour le siège qui joue.
+     * @param ctx Position, pioche, catalogue et tuile en main.
+     * @return Candidats du meilleur au moins bon (carré, puis cases, puis placements).
+     */
+    std::vector<Option> rank(const TurnContext& ctx) const;
+
+    /**
+     * @brief Évalue une tuile pour un siège (un seul fil).
+     * @param position Position courante.
+     * @param seat Siège qui pose.
+     * @param shape Orientations de la tuile.
+     */
+    static Option evaluate(const Position& position, int seat, const ShapeSet& shape);
+
+private:
+    int threads_;
+
+    /** @brief Évalue les placements légaux `moves` d’une tuile. */
+    static Option evaluateMoves_(const Position& position, int seat, const ShapeSet& shape, const MoveList& moves);
+};
+
+#endif // EXCHANGEADVISOR_HPP_INCLUDED
@@ -0,0 +1,64 @@
+#ifndef FINALCELLSOLVER_HPP_INCLUDED
+#define FINALCELLSOLVER_HPP_INCLUDED
+
+#include <array>
+#include <optional>
+#include <vector>
+#include "Engine/Position.hpp"
+
+/**
+ * @class FinalCellSolver
+ * @brief Solveur exact de la phase finale 1x1 (Game::finalSingleCellPhase).
+ *
+ * Les cases légales d’un siège sont ses ancres. Une case fait passer le plus grand carré
+ * (côté k) à un côté s > k si et seulement si elle est l’unique case manquante d’une fenêtre
+ * de côté s ; elle est alors aussi l’unique case manquante d’une fenêtre de chaque côté
+ * entre k+1 et s (sous-fenêtres qui la contiennent). Les cases qui complètent une fenêtre
+ * sont donc marquées côté par côté à partir de k+1, par masques (toutes les origines d’une ligne à la fois), jusqu’au
+ * premier côté sans fenêtre presque pleine ; chaque ancre s’évalue ensuite en comptant ses
+ * niveaux marqués, sans recalculer le plus grand carré. Seules les ancres qui capturent un
+ * bonus (la case du bonus est gagnée en plus) sont rejouées sur une copie de la position.
+ *
+ * Le meilleur choix maximise le plus grand carré, puis le nombre de cases ; à égalité, la
+ * première case dans l’ordre des lignes.
+ */
+class FinalCellSolver {
+public:
+    /**
+     * @struct Choice
+     * @brief Évaluation d’une case 1x1.
+     */
+    struct Choice {
+        int x = 0;
+        int y = 0;
+        /// Plus grand carré après la pose.
+        int maxSquare = 0;
+        /// Nombre de cases après la pose (case de bonus capturée comprise).
+        int cellCount = 0;
+        /// Gain de côté du plus grand carré.
+        int squareGain = 0;
+        /// Gain de cases (1, ou 2 avec une capture de bonus).
+        int cellGain = 0;
+    };
+
+    /**
+     * @brief Évalue toutes les cases 1x1 légales d’un siège.
+     * @return Une évaluation par ancre, dans l’ordre des lignes.
+     */
+    static std::vector<Choice> evaluate(const Position& position, int seat);
+
+    /**
+     * @brief Meilleure case 1x1 d’un siège.
+     * @return Le choix optimal, ou std::nullopt si le siège n’a aucune case légale.
+     */
+    static std::optional<Choice> best(const Position& position, int seat);
+
+    /**
+     * @brief Joue toute la phase finale : chaque siège (ordre 0..n-1) ayant un coupon pose
+     *        sa meilleure case sur la position laissée par les précédents.
+     * @return Choix de chaque siège (std::nullopt : sans coupon ou sans case légale).
+     */
+    static std::array<std::optional<Choice>, kMaxPlayers> solve(const Position& position);
+};
+
+#endif // FINALCELLSOLVER_HPP_INCLUDED
@@ -0,0 +1,52 @@
+#ifndef HEURISTICAGENT_HPP_INCLUDED
+#define HEURISTICAGENT_HPP_INCLUDED
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include "AI/Agent.hpp"
+#include "AI/HeuristicPolicy.hpp"
+
+/**
+ * @class HeuristicAgent
+ * @brief Joueur ordinateur sans recherche : chaque tuile est posée selon une politique
+ *        HeuristicPolicy (aléatoire, plus grand carré, bonus, blocage).
+ *
+ * Une décision coûte quelques microsecondes et n’alloue rien : adversaires faibles et
+ * rapides pour les parties de test et les simulations. L’agent ne fait pas d’échange ;
+ * les autres décisions (départ, pierre, case finale) sont celles de Agent.
+ */
+class HeuristicAgent : public Agent {
+public:
+    /**
+     * @struct Config
+     * @brief Politique et graine.
+     */
+    struct Config {
+        HeuristicPolicy::Kind kind = HeuristicPolicy::Kind::Random;
+        /// Graine du générateur (0 : aléatoire).
+        std::uint32_t seed = 0;
+    };
+
+    /** @brief Agent avec les paramètres par défaut (placement aléatoire). */
+    HeuristicAgent();
+
+    /** @brief Agent avec des paramètres donnés. */
+    explicit HeuristicAgent(Config config);
+
+    std::string name() const override { return HeuristicPolicy::name(policy_.kind()); }
+
+    double defaultSeconds() const override { return 0.1; }
+
+    /** @brief Politique de l’agent. */
+    const HeuristicPolicy& policy() const { return policy_; }
+
+protected:
+    TurnDecision search(const TurnContext& ctx, const SearchLimits& limits) override;
+
+private:
+    HeuristicPolicy policy_;
+    std::mt19937 rng_;
+};
+
+#endif // HEURISTICAGENT_HPP_INCLUDED
@@ -0,0 +1,80 @@
+#ifndef HEURISTICPOLICY_HPP_INCLUDED
+#define HEURISTICPOLICY_HPP_INCLUDED
+
+#include <random>
+#include "Engine/BitGrid.hpp"
+#include "Engine/MoveGenerator.hpp"
+#include "Engine/Position.hpp"
+#include "Engine/Shape.hpp"
+
+/**
+ * @class HeuristicPolicy
+ * @brief Politiques de placement à un coup, sans recherche ni allocation : adversaires de
+ *        simulation (HeuristicAgent) et politiques de fin de partie de MctsAgent.
+ *
+ * - Random : placement légal uniforme, tiré parmi les lignes d’origines légales sans
+ *   construire de liste de coups.
+ * - GreedySquare : croissance du plus grand carré (côté k) — cases des fenêtres k+1
+ *   réalisables (cases possédées ou libres) contenant déjà une case du siège, puis contact
+ *   avec le territoire.
+ * - BonusSeeker : côtés libres des bonus encore capturables les plus proches (compteurs
+ *   Position::bonusDistance), puis contact avec le territoire ; sans bonus capturable,
+ *   comme GreedySquare.
+ * - Blocker : cases voisines des ancres adverses (les occuper retire ces ancres aux
+ *   adversaires), puis contact avec le territoire.
+ *
+ * Les politiques à score calculent, une fois par décision, deux masques (critère principal
+ * puis secondaire) ; le score d’un placement est son nombre de cases dans chaque masque.
+ * La légalité d’une ligne d’origines se lit par segments de la forme (comme Playout) ; le
+ * score principal est évalué pour les 32 origines d’une ligne à la fois, sur des compteurs
+ * en tranches de bits, et le secondaire pour les seules lignes ex æquo sur le principal.
+ * Les égalités sont départagées au hasard.
+ *
+ * Débit (bench heuristics, Release, un cœur) : environ 2,4 M décisions/s pour Random,
+ * 0,8 à 1 M pour les politiques à score.
+ */
+class HeuristicPolicy {
+public:
+    /**
+     * @enum Kind
+     * @brief Politique de choix.
+     */
+    enum class Kind {
+        Random,
+        GreedySquare,
+        BonusSeeker,
+        Blocker
+    };
+
+    /** @brief Politique d’un type donné. */
+    explicit HeuristicPolicy(Kind kind = Kind::Random) : kind_(kind) {}
+
+    Kind kind() const { return kind_; }
+
+    /** @brief Nom affiché d’une politique (ex. "Greedy square"). */
+    static const char* name(Kind kind);
+
+    /**
+     * @brief Choisit un placement de la tuile pour un siège.
+     * @param position Position courante.
+     * @param seat Siège qui pose.
+     * @param shape Orientations de la tuile.
+     * @param rng Générateur (tirages et départage des égalités).
+     * @param out Placement choisi.
+     * @return false si la tuile n’a aucun placement légal.
+     */
+    bool choose(const Position& position, int seat, const ShapeSet& shape, std::mt19937& rng, Move& out) const;
+
+private:
+    Kind kind_;
+
+    /** @brief Placement légal uniforme. */
+    static bool chooseRandom_(const Position& position, int seat, const ShapeSet& shape,
+                              std::mt19937& rng, Move& out);
+
+    /** @brief Placement de score (principal, secondaire) maximal. */
+    static bool chooseBest_(const PlacementMasks& masks, const ShapeSet& shape, const BitGrid& primary,
+                            const BitGrid& secondary, std::mt19937& rng, Move& out);
+};
+
+#endif // HEURISTICPOLICY_HPP_INCLUDED
@@ -0,0 +1,277 @@
+#ifndef MCTSAGENT_HPP_INCLUDED
+#define MCTSAGENT_HPP_INCLUDED
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "AI/Agent.hpp"
+#include "AI/HeuristicPolicy.hpp"
+#include "Engine/FastRng.hpp"
+#include "Engine/Playout.hpp"
+
+/**
+ * @class MctsAgent
+ * @brief Joueur ordinateur par recherche arborescente Monte-Carlo (UCT, max-n).
+ *
+ * Chaque itération part d’une copie de la position (Position + TileBag, sans allocation),
+ * descend l’arbre en appliquant les coups, développe un nœud puis termine la partie par
+ * des coups légaux (politique `rollout` : aléatoires par défaut) jusqu’à la fin de la
+ * 9e manche et la phase 1x1 finale.
+ * La récompense de chaque siège (part des adversaires battus) est remontée sur les arêtes
+ * jouées par ce siège (max-n).
+ *
+ * Structure de l’arbre :
+ * - un nœud de décision porte les placements de la tuile tirée par le siège qui joue ;
+ *   à la racine s’y ajoutent les placements des tuiles de la fenêtre (échange contre un coupon) ;
+ * - sous chaque arête, les tirages suivants (hasard) mènent à un nœud fils par tuile tirée :
+ *   dans la fenêtre connue le tirage est fixe, au-delà il suit la composition de la pioche.
+ *
+ * Information imparfaite (ISMCTS) : au-delà de la fenêtre, l’ordre de la pioche est caché.
+ * Avec `determinizations` > 0, chaque itération échantillonne un ordre complet des tuiles
+ * cachées compatible avec la fenêtre et la composition (TileBag::determinize) et joue toute
+ * l’itération dans cet ordre. Les nœuds étant indexés par la tuile tirée, ce que le siège
+ * observe, les statistiques sont partagées entre tous les échantillons. Avec k > 1, la feuille
+ * est évaluée par k simulations, chacune sur un nouvel ordre des tuiles restantes : la descente
+ * et l’expansion sont amorties sur k parties. Avec 0, chaque tirage est échantillonné
+ * séparément à partir de la composition (nœuds de hasard classiques).
+ *
+ * Les arêtes sont triées par un a priori (contacts avec son territoire) et ouvertes
+ * progressivement (progressive widening) ; sous la racine, seules les `maxChildren`
+ * meilleures sont conservées. L’arbre est plafonné à `maxEdges` arêtes : au-delà, les
+ * itérations continuent sans développer. Le nombre de parties simulées par seconde est
+ * mesuré à chaque décision : c’est lui qui borne la force de l’agent.
+ *
+ * Parallélisme (`threads` > 1) :
+ * - Parallelism::Tree : tous les fils partagent un arbre. Compteurs atomiques, perte
+ *   virtuelle (la visite est comptée à la descente, la récompense à la remontée, ce qui
+ *   écarte les autres fils d’un chemin en cours) et expansion sans verrou (blocs d’arêtes
+ *   réservés par fetch_add, nœud publié par compare-and-swap sur la liste des tirages) ;
+ * - Parallelism::Root : repli où chaque fil a son propre arbre ; les visites des arêtes
+ *   de la racine sont additionnées à la fin.
+ */
+class MctsAgent : public Agent {
+public:
+    /**
+     * @enum Parallelism
+     * @brief Répartition du travail entre les fils de recherche.
+     */
+    enum class Parallelism {
+        /// Un arbre partagé (verrouillage nul, perte virtuelle).
+        Tree,
+        /// Un arbre par fil, racines fusionnées.
+        Root
+    };
+
+    /**
+     * @struct Config
+     * @brief Paramètres de recherche.
+     */
+    struct Config {
+        /// Nombre maximal d’itérations par décision, tous fils confondus.
+        std::size_t iterations = 1000000;
+        /// Budget par défaut d’une décision, en secondes (decideTurn sans échéance).
+        double seconds = 1.0;
+        /// Constante d’exploration UCB1 (récompenses dans [0, 1]).
+        double exploration = 0.7;
+        /// Nombre maximal d’arêtes, tous arbres confondus (mémoire : au plus 44 octets par arête).
+        std::size_t maxEdges = std::size_t(1) << 20;
+        /// Arêtes conservées par nœud sous la racine (meilleurs a priori).
+        int maxChildren = 48;
+        /// Ordres de pioche échantillonnés par itération (ISMCTS) ; 0 : tirages indépendants.
+        int determinizations = 1;
+        /// Nombre de fils de recherche.
+        int threads = 1;
+        /// Répartition entre fils.
+        Parallelism parallelism = Parallelism::Tree;
+        /// Graine du générateur (0 : aléatoire).
+        std::uint32_t seed = 0;
+        /// Politique des simulations (HeuristicPolicy).
+        HeuristicPolicy::Kind rollout = HeuristicPolicy::Kind::Random;
+    };
+
+    /**
+     * @struct Stats
+     * @brief Statistiques de la dernière décision.
+     */
+    struct Stats {
+        /// Parties simulées (itérations × ordres échantillonnés).
+        std::size_t playouts = 0;
+        std::size_t iterations = 0;
+        double seconds = 0.0;
+        double playoutsPerSecond = 0.0;
+        std::size_t nodes = 0;
+        std::size_t edges = 0;
+        int maxDepth = 0;
+        int threads = 1;
+        /// Récompense moyenne estimée du coup choisi.
+        double value = 0.0;
+    };
+
+    /**
+     * @struct Candidate
+     * @brief Coup de la racine avec ses statistiques (classement d’une décision).
+     */
+    struct Candidate {
+        /// Indice dans la fenêtre de la tuile prise en échange (-1 : pas d’échange).
+        int exchangeSlot = -1;
+        /// Indice de catalogue de la tuile posée.
+        int tile = -1;
+        Move move{};
+        std::uint32_t visits = 0;
+        /// Récompense moyenne estimée.
+        double value = 0.0;
+    };
+
+    /** @brief Agent avec les paramètres par défaut. */
+    MctsAgent();
+
+    /** @brief Agent avec des paramètres donnés. */
+    explicit MctsAgent(Config config);
+
+    ~MctsAgent() override;
+
+    std::string name() const override { return "MCTS"; }
+
+    double defaultSeconds() const override { return config_.seconds; }
+
+    std::string lastReport() const override;
+
+    /** @brief Statistiques de la dernière décision. */
+    const Stats& lastStats() const { return stats_; }
+
+    /** @brief Paramètres courants. */
+    const Config& config() const { return config_; }
+
+    /** @brief Placements de la racine de la dernière décision, du plus visité au moins visité. */
+    const std::vector<Candidate>& lastCandidates() const { return candidates_; }
+
+protected:
+    TurnDecision search(const TurnContext& ctx, const SearchLimits& limits) override;
+
+private:
+    /// Coup « passer » (aucun placement légal).
+    static constexpr std::uint8_t kPass = 0xFF;
+    /// Absence d’indice.
+    static constexpr std::uint32_t kNone = 0xFFFFFFFFu;
+
+    /**
+     * @struct Edge
+     * @brief Action d’un nœud de décision et statistiques du siège qui la joue.
+     *
+     * `move`, `slot` et `prior` sont écrits avant la publication du nœud puis en lecture seule.
+     */
+    struct Edge {
+        Move move{};
+        /// 0 : tuile en main ; k > 0 : échange avec la (k-1)-ième tuile de la fenêtre.
+        std::uint8_t slot = 0;
+        float prior = 0.0f;
+        /// Visites, comptées dès la descente (perte virtuelle).
+        std::atomic<std::uint32_t> visits{0};
+        /// Somme des récompenses du siège qui joue l’arête.
+        std::atomic<float> value{0.0f};
+        /// Tête de la liste chaînée des tirages (Outcome) observés sous l’arête.
+        std::atomic<std::uint32_t> outcome{kNone};
+    };
+
+    /**
+     * @struct Node
+     * @brief Nœud de décision : arêtes contiguës, triées par a priori.
+     */
+    struct Node {
+        std::uint32_t firstEdge = 0;
+        std::uint32_t edgeCount = 0;
+        std::atomic<std::uint32_t> visits{0};
+    };
+
+    /**
+     * @struct Outcome
+     * @brief Tirage observé sous une arête : tuile tirée et nœud correspondant (immuable une fois publié).
+     */
+    struct Outcome {
+        std::uint16_t tile = 0;
+        std::uint32_t node = kNone;
+        std::uint32_t next = kNone;
+    };
+
+    /**
+     * @struct Tree
+     * @brief Réserves de taille fixe d’un arbre, allouées une fois et réutilisées.
+     */
+    struct Tree {
+        std::size_t capacity = 0;
+        std::unique_ptr<Node[]> nodes;
+        std::unique_ptr<Edge[]> edges;
+        std::unique_ptr<Outcome[]> outcomes;
+        std::atomic<std::size_t> nodeCount{0};
+        std::atomic<std::size_t> edgeCount{0};
+        std::atomic<std::size_t> outcomeCount{0};
+    };
+
+    /**
+     * @struct Worker
+     * @brief État propre à un fil de recherche.
+     */
+    struct Worker {
+        std::mt19937 rng;
+        /// Générateur des simulations uniformes (Playout).
+        FastRng fast;
+        MoveList moves;
+        /// Coups candidats d’une expansion : (coup, case de fenêtre, a priori).
+        std::vector<std::pair<Move, std::pair<std::uint8_t, float>>> scratch;
+        /// Arêtes parcourues par l’itération courante, avec le siège qui les a jouées.
+        std::vector<std::pair<std::uint32_t, std::uint8_t>> path;
+        std::size_t iterations = 0;
+        int maxDepth = 0;
+    };
+
+    Config config_;
+    Stats stats_;
+    std::vector<Candidate> candidates_;
+    std::vector<std::unique_ptr<Tree>> trees_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    /// Moteur des simulations uniformes, précompilé pour le catalogue de la décision.
+    Playout playout_;
+
+    /**
+     * @brief Crée un nœud de décision pour le siège à jouer avec la tuile `tile`.
+     * @param root Vrai à la racine : ajoute les échanges possibles et garde toutes les arêtes.
+     * @return Indice du nœud (non encore publié), ou kNone si la réserve est épuisée.
+     */
+    std::uint32_t expand_(Tree& tree, Worker& w, const Position& pos, const TileBag& bag,
+                          const std::vector<ShapeSet>& catalog, int tile, bool root) const;
+
+    /**
+     * @brief Choisit une arête par UCB1 parmi les arêtes ouvertes (élargissement progressif)
+     *        et compte la visite (perte virtuelle).
+     */
+    std::uint32_t select_(Tree& tree, Node& node) const;
+
+    /**
+     * @brief Début du tour du siège à jouer : pierre éventuelle, puis tirage de la tuile.
+     * @return Indice de catalogue de la tuile tirée.
+     */
+    static int beginTurn_(Worker& w, Position& pos, TileBag& bag);
+
+    /**
+     * @brief Termine la partie par les coups de la politique `rollout`, puis la phase 1x1 finale.
+     *
+     * La politique aléatoire passe par Playout ; les autres jouent HeuristicPolicy.
+     *
+     * @param tile Tuile déjà tirée par le siège à jouer (-1 : aucune, partie terminée).
+     * @param reward Sortie : récompense de chaque siège.
+     */
+    void rollout_(Worker& w, Position& pos, TileBag& bag, const std::vector<ShapeSet>& catalog, int tile,
+                  std::array<float, kMaxPlayers>& reward) const;
+
+    /**
+     * @brief Une itération complète (sélection, expansion, simulation(s), rétropropagation).
+     * @return Profondeur atteinte dans l’arbre.
+     */
+    int iterate_(Tree& tree, Worker& w, const TurnContext& ctx) const;
+};
+
+#endif // MCTSAGENT_HPP_INCLUDED
@@ -0,0 +1,128 @@
+#ifndef OPENINGBOOK_HPP_INCLUDED
+#define OPENINGBOOK_HPP_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Engine/Position.hpp"
+
+/// Coups conservés par position du livre.
+constexpr int kBookMoves = 4;
+
+/**
+ * @struct BookMove
+ * @brief Case de départ du livre et sa valeur.
+ */
+struct BookMove {
+    std::uint8_t x = 0;
+    std::uint8_t y = 0;
+    /// Résultat moyen du siège en simulation (part des adversaires battus), × 65535.
+    std::uint16_t value = 0;
+
+    /** @brief Valeur dans [0, 1]. */
+    double share() const { return value / 65535.0; }
+};
+
+/**
+ * @struct BookEntry
+ * @brief Position du livre (32 octets dans le fichier) : meilleurs coups d’abord, exprimés
+ *        dans le repère canonique de la position.
+ */
+struct BookEntry {
+    /// Clé canonique (OpeningBook::keyOf), jamais nulle ; 0 : emplacement libre.
+    std::uint64_t key = 0;
+    /// Parties simulées pour établir l’entrée.
+    std::uint32_t samples = 0;
+    std::uint8_t count = 0;
+    std::uint8_t reserved[3] = {};
+    std::array<BookMove, kBookMoves> moves{};
+};
+
+/**
+ * @class OpeningBook
+ * @brief Livre d’ouvertures de la phase des cases de départ, lu par projection en mémoire.
+ *
+ * Une position est identifiée par la taille du plateau, le nombre de joueurs, le siège qui
+ * place sa case et les cases de départ déjà posées (par siège). Les positions équivalentes
+ * par symétrie du plateau carré (8 symétries) partagent une entrée : la clé est le plus
+ * petit des hachages des positions transformées, les coups sont rangés dans ce repère.
+ *
+ * Le fichier (outil `book`) est une table de hachage à adressage ouvert : un en-tête puis
+ * une puissance de 2 d’entrées BookEntry, remplie à moitié au plus. Il est projeté en mémoire
+ * (mmap, MapViewOfFile sous Windows) sans copie ni analyse ; une recherche lit en moyenne
+ * moins de deux entrées. Les bonus, tirés à chaque partie, ne font pas partie de la clé :
+ * les coups du livre tombés sur une case occupée sont ignorés par l’appelant.
+ */
+class OpeningBook {
+public:
+    /**
+     * @struct Key
+     * @brief Clé canonique d’une position et symétrie qui y mène.
+     */
+    struct Key {
+        std::uint64_t hash = 0;
+        /// Symétrie appliquée (0 : identité, voir transform()).
+        int symmetry = 0;
+    };
+
+    OpeningBook() = default;
+    ~OpeningBook();
+    OpeningBook(const OpeningBook&) = delete;
+    OpeningBook& operator=(const OpeningBook&) = delete;
+
+    /**
+     * @brief Projette un livre en mémoire (le livre ouvert précédemment est fermé).
+     * @return false si le fichier est absent ou invalide (livre vide).
+     */
+    bool open(const std::string& path);
+
+    /** @brief Libère la projection. */
+    void close();
+
+    bool isOpen() const { return entries_ != nullptr; }
+
+    /** @brief Nombre de positions du livre. */
+    std::size_t size() const { return count_; }
+
+    /**
+     * @brief Coups du livre pour le siège qui place sa case de départ.
+     * @param position Position de la phase de départ.
+     * @param seat Siège qui place sa case.
+     * @param out Coups dans le repère du plateau, meilleurs d’abord (coups hors du plateau omis).
+     * @return Nombre de coups (0 : position absente du livre ou entrée invalide).
+     */
+    int lookup(const Position& position, int seat, std::array<BookMove, kBookMoves>& out) const;
+
+    /**
+     * @brief Clé canonique d’une position de la phase de départ.
+     * @return false si ce n’est pas une position de départ (un siège a plus d’une case, ou
+     *         `seat` a déjà la sienne).
+     */
+    static bool keyOf(const Position& position, int seat, Key& key);
+
+    /**
+     * @brief Applique une symétrie du plateau à une case.
+     * @param symmetry 0..7 (0..3 : identité et miroirs, 4..7 : avec échange des axes).
+     * @param inverse Vrai pour la symétrie réciproque.
+     * @param side Côté du plateau (carré ; les plateaux rectangulaires n’utilisent que 0).
+     */
+    static void transform(int symmetry, bool inverse, int side, int& x, int& y);
+
+    /**
+     * @brief Écrit un livre (clés uniques et non nulles).
+     * @return false si le fichier ne peut pas être écrit.
+     */
+    static bool save(const std::string& path, const std::vector<BookEntry>& entries);
+
+private:
+    const BookEntry* entries_ = nullptr;
+    std::uint32_t mask_ = 0;
+    std::uint32_t count_ = 0;
+    /// Projection : adresse et taille.
+    void* view_ = nullptr;
+    std::size_t bytes_ = 0;
+};
+
+#endif // OPENINGBOOK_HPP_INCLUDED
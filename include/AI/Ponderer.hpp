@@ -0,0 +1,125 @@
+#ifndef PONDERER_HPP_INCLUDED
+#define PONDERER_HPP_INCLUDED
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "AI/Agent.hpp"
+#include "AI/MctsAgent.hpp"
+
+/**
+ * @class Ponderer
+ * @brief Analyse en tâche de fond pendant la réflexion d’un joueur humain.
+ *
+ * Pendant que Game attend une saisie (std::getline), un fil de recherche travaille sur
+ * une copie de la position du joueur humain :
+ * 1. classement des placements de la tuile en main (MctsAgent), consultable comme conseils ;
+ * 2. si le joueur suivant est un ordinateur, préparation de son tour pour les placements
+ *    humains les plus probables (ordre du classement) : l’agent du joueur suivant décide
+ *    sur la position qui en résulterait ;
+ * 3. affinage du classement jusqu’à l’arrêt.
+ *
+ * stop() annule la recherche en cours (jeton d’annulation passé aux agents) et attend le fil.
+ * Au tour de l’ordinateur, take() rend la décision préparée si la position réelle est l’une
+ * des positions anticipées : même plateau, même état de tour (clés de Zobrist) et fenêtre
+ * connue prolongeant celle de l’anticipation. Le tour est alors immédiat.
+ *
+ * Les agents utilisés en tâche de fond ne doivent pas servir ailleurs avant stop().
+ */
+class Ponderer {
+public:
+    /**
+     * @struct Config
+     * @brief Répartition du temps de réflexion.
+     */
+    struct Config {
+        /// Durée de la première analyse (premiers conseils disponibles).
+        double hintSeconds = 0.5;
+        /// Nombre de placements humains anticipés pour le joueur suivant.
+        int predictions = 6;
+        /// Durée de l’affinage final des conseils.
+        double refineSeconds = 10.0;
+    };
+
+    /**
+     * @struct Prepared
+     * @brief Décision préparée pour le joueur suivant.
+     */
+    struct Prepared {
+        TurnDecision decision;
+        /// Résumé de la recherche de l’agent (Agent::lastReport).
+        std::string report;
+    };
+
+    /** @brief Ponderer avec les paramètres par défaut. */
+    Ponderer();
+
+    /** @brief Ponderer avec des paramètres donnés. */
+    explicit Ponderer(Config config);
+
+    /** @brief Arrête le fil en cours. */
+    ~Ponderer();
+
+    Ponderer(const Ponderer&) = delete;
+    Ponderer& operator=(const Ponderer&) = delete;
+
+    /**
+     * @brief Lance l’analyse de la position du joueur humain (arrête la précédente).
+     * @param ctx Position, pioche et tuile en main du joueur humain (copiées).
+     * @param nextBot Agent du joueur suivant, ou nullptr s’il est humain.
+     */
+    void start(const TurnContext& ctx, Agent* nextBot);
+
+    /** @brief Annule l’analyse en cours et attend la fin du fil. */
+    void stop();
+
+    /**
+     * @brief Meilleurs placements connus pour la tuile en main (dernière analyse terminée).
+     * @param count Nombre maximal de conseils.
+     */
+    std::vector<MctsAgent::Candidate> hints(std::size_t count) const;
+
+    /**
+     * @brief Décision préparée correspondant à une position réelle (à appeler après stop()).
+     * @return La décision, ou std::nullopt si la position n’a pas été anticipée.
+     */
+    std::optional<Prepared> take(const Position& position, const TileBag& bag, int tile);
+
+    /** @brief Nombre de tours d’ordinateur servis par une décision préparée. */
+    std::size_t hits() const { return hits_; }
+
+private:
+    /**
+     * @struct Anticipation
+     * @brief Position anticipée du joueur suivant et décision préparée.
+     */
+    struct Anticipation {
+        std::uint64_t key = 0;
+        std::vector<int> window;
+        Prepared prepared;
+    };
+
+    Config config_;
+    MctsAgent analyst_;
+    std::thread worker_;
+    /// Jeton de l’analyse en cours (un nouveau à chaque start()).
+    CancellationToken token_;
+    mutable std::mutex mutex_;
+    std::vector<MctsAgent::Candidate> hints_;
+    /// Parties simulées par l’analyse qui a produit hints_.
+    std::size_t hintPlayouts_ = 0;
+    std::vector<Anticipation> anticipations_;
+    std::size_t hits_ = 0;
+
+    /** @brief Corps du fil : conseils, anticipations, affinage. */
+    void run_(Position position, TileBag bag, const std::vector<ShapeSet>* catalog, int tile, Agent* nextBot,
+              CancellationToken token);
+
+    /** @brief Classe les placements (une analyse de `seconds` secondes) et publie les conseils. */
+    void analyse_(const TurnContext& ctx, double seconds, const CancellationToken& token);
+};
+
+#endif // PONDERER_HPP_INCLUDED
@@ -0,0 +1,57 @@
+#ifndef SEARCHLIMITS_HPP_INCLUDED
+#define SEARCHLIMITS_HPP_INCLUDED
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+/**
+ * @class CancellationToken
+ * @brief Jeton d’annulation partagé : toutes les copies voient le même drapeau.
+ *
+ * Celui qui lance une recherche garde une copie et appelle cancel() ; la recherche consulte
+ * cancelled() dans sa boucle et rend au plus vite son meilleur coup.
+ */
+class CancellationToken {
+public:
+    CancellationToken() : flag_(std::make_shared<std::atomic<bool>>(false)) {}
+
+    /** @brief Demande l’arrêt (définitif pour ce jeton). */
+    void cancel() const { flag_->store(true, std::memory_order_relaxed); }
+
+    /** @brief Indique si l’arrêt a été demandé. */
+    bool cancelled() const { return flag_->load(std::memory_order_relaxed); }
+
+private:
+    std::shared_ptr<std::atomic<bool>> flag_;
+};
+
+/**
+ * @struct SearchLimits
+ * @brief Limites d’une décision : échéance (horloge monotone) et jeton d’annulation.
+ */
+struct SearchLimits {
+    using Clock = std::chrono::steady_clock;
+
+    /// Instant auquel la décision doit être rendue.
+    Clock::time_point deadline = Clock::time_point::max();
+    /// Annulation anticipée.
+    CancellationToken token;
+
+    /**
+     * @brief Limites d’une décision qui dispose de `seconds` secondes à partir de maintenant.
+     * @param seconds Budget de temps.
+     * @param token Jeton d’annulation (nouveau par défaut).
+     */
+    static SearchLimits within(double seconds, CancellationToken token = {}) {
+        SearchLimits limits;
+        limits.deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+        limits.token = std::move(token);
+        return limits;
+    }
+
+    /** @brief Vrai si l’échéance est passée ou si l’annulation est demandée. */
+    bool expired() const { return token.cancelled() || Clock::now() >= deadline; }
+};
+
+#endif // SEARCHLIMITS_HPP_INCLUDED
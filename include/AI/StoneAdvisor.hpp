@@ -0,0 +1,86 @@
+#ifndef STONEADVISOR_HPP_INCLUDED
+#define STONEADVISOR_HPP_INCLUDED
+
+#include <array>
+#include <vector>
+#include "Engine/MoveGenerator.hpp"
+#include "Engine/Position.hpp"
+#include "Engine/Shape.hpp"
+
+/**
+ * @class StoneAdvisor
+ * @brief Conseil de pose de la pierre du Rock bonus : classe les cases vides.
+ *
+ * Une pierre ne change ni l’adjacence aux adversaires ni le contact avec un territoire :
+ * elle retire exactement les placements légaux dont l’empreinte la recouvre. Les placements
+ * de chaque siège sont donc générés une seule fois (toutes les tuiles données), et chacun
+ * incrémente le compteur de ses cases ; l’effet d’une pierre sur n’importe quelle case se lit
+ * ensuite dans ces compteurs, sans nouvelle génération par case candidate.
+ *
+ * La croissance du plus grand carré d’un adversaire (côté k) est suivie par ses carrés de
+ * côté k+1 encore réalisables : cases possédées ou libres pour lui, dont au plus 2k+1 vides
+ * (une bande en L autour d’un carré de côté k). Une pierre sur une case vide d’un tel carré
+ * le rend irréalisable.
+ *
+ * Score d’une case : (placements adverses retirés − placements du siège retirés) par tuile
+ * comptée + squareWeight × carrés de croissance adverses bloqués.
+ */
+class StoneAdvisor {
+public:
+    /**
+     * @struct Config
+     * @brief Poids du score.
+     */
+    struct Config {
+        /// Poids d’un carré de croissance adverse bloqué (en placements retirés par tuile).
+        double squareWeight = 10.0;
+    };
+
+    /**
+     * @struct Option
+     * @brief Évaluation d’une case vide.
+     */
+    struct Option {
+        int x = 0;
+        int y = 0;
+        /// Placements légaux retirés à l’ensemble des adversaires.
+        int opponentPlacements = 0;
+        /// Placements légaux retirés au siège qui pose la pierre.
+        int ownPlacements = 0;
+        /// Carrés de croissance adverses rendus irréalisables.
+        int squaresBlocked = 0;
+        double score = 0.0;
+    };
+
+    /** @brief Conseiller avec les poids par défaut. */
+    StoneAdvisor();
+
+    /** @brief Conseiller avec des poids donnés. */
+    explicit StoneAdvisor(Config config);
+
+    /**
+     * @brief Classe les cases vides pour la pierre d’un siège.
+     * @param position Position courante.
+     * @param seat Siège qui pose la pierre.
+     * @param shapes Tuiles dont les placements sont comptés (en général tout le catalogue).
+     * @param count Nombre maximal de cases rendues.
+     * @return Cases du meilleur score au moins bon.
+     */
+    std::vector<Option> rank(const Position& position, int seat, const std::vector<ShapeSet>& shapes,
+                             std::size_t count) const;
+
+private:
+    /// Compteur par case (indice y * kMaxSide + x).
+    using CellCounts = std::array<int, kMaxSide * kMaxSide>;
+
+    Config config_;
+
+    /** @brief Ajoute à `counts` chaque case de chaque placement légal de `masks`. */
+    static void countCoverage(const PlacementMasks& masks, const std::vector<ShapeSet>& shapes,
+                              MoveList& moves, CellCounts& counts);
+
+    /** @brief Ajoute à `counts` chaque case vide de chaque carré de croissance d’un siège. */
+    static void countGrowthSquares(const Position& position, int seat, CellCounts& counts);
+};
+
+#endif // STONEADVISOR_HPP_INCLUDED
@@ -2,11 +2,28 @@
 #define BOARD_HPP_INCLUDED
 #include <vector>
 #include <map>
+#include <deque>
 #include <memory>
+#include <cstdint>
+#include <functional>
+#include <random>
 #include "Bonus/Bonus.hpp"
+#include "Engine/BitGrid.hpp"
 
 class Game;
 
+/**
+ * @struct DirtyRect
+ * @brief Zone rectangulaire (bornes incluses) du plateau modifiée par un coup,
+ *        halo orthogonal compris.
+ */
+struct DirtyRect {
+    int x0 = 0;
+    int y0 = 0;
+    int x1 = -1;
+    int y1 = -1;
+};
+
 /**
  * @class Board
  * @brief Représente le plateau de jeu et gère les cases occupées, les propriétaires
@@ -15,7 +32,9 @@ class Game;
  * Le plateau contient :
  * - une grille de caractères (`grid`) pour l’affichage ('.', '#', 'X', etc.) ;
  * - une grille d’identifiants de joueurs (`ownerGrid`) indiquant qui possède chaque case ;
- * - une collection de cases bonus (`bonuses`) placées à des coordonnées précises.
+ * - une collection de cases bonus (`bonuses`) placées à des coordonnées précises ;
+ * - la frontière de chaque joueur (`anchors`) : cases vides adjacentes à son territoire et
+ *   à aucun territoire adverse, tenue à jour incrémentalement à chaque modification de case.
  *
  * La classe fournit des méthodes pour :
  * - initialiser la taille du plateau en fonction du nombre de joueurs ;
@@ -35,6 +54,56 @@ class Board {
         std::map<std::pair<int,int>, std::shared_ptr<Bonus>> bonuses;
         /// Grille des propriétaires : 0 = aucun, sinon ID du joueur.
         std::vector<std::vector<int>> ownerGrid;
+        /// Cases vides sans aucune case possédée dans leur 4-voisinage.
+        BitGrid neutral{};
+        /// Ancres par joueur : cases vides voisines de son territoire et d’aucun adversaire.
+        std::map<int, BitGrid> anchors;
+        /// Compteur de modifications : incrémenté à chaque case modifiée.
+        std::uint64_t version = 0;
+        /// Version en dessous de laquelle l’historique des zones modifiées est perdu.
+        std::uint64_t dirtyFloor = 0;
+        /// Historique borné des zones modifiées : (version après modification, zone).
+        std::deque<std::pair<std::uint64_t, DirtyRect>> dirtyLog;
+        /// Nombre maximal d’entrées conservées dans `dirtyLog`.
+        static constexpr std::size_t kDirtyLogSize = 64;
+
+        /**
+         * @brief Recalcule le statut (neutre / ancre d’un joueur / bloquée) d’une case.
+         *
+         * Une case vide dont les voisines possédées appartiennent toutes au même joueur
+         * est une ancre de ce joueur ; sans voisine possédée, elle est neutre ; avec des
+         * voisines de plusieurs joueurs, elle n’est plaçable par personne.
+         *
+         * @param x Colonne.
+         * @param y Ligne.
+         */
+        void refreshCell(int x, int y);
+
+        /**
+         * @brief Enregistre dans `dirtyLog` la zone d’une case modifiée (halo compris).
+         *
+         * Une zone qui touche la dernière entrée y est fusionnée : les cases d’une même
+         * tuile forment ainsi une seule entrée.
+         *
+         * @param x Colonne de la case modifiée.
+         * @param y Ligne de la case modifiée.
+         */
+        void markDirty(int x, int y);
+
+        /**
+         * @brief Place les bonus (voir placeBonus(int)).
+         *
+         * @param numberOfPlayers Nombre de joueurs.
+         * @param below Tirage uniforme dans [0, n).
+         */
+        void placeBonusWith(int numberOfPlayers, const std::function<int(int)>& below);
+
+        /**
+         * @brief Met à jour la frontière après la modification d’une case (elle et ses 4 voisines).
+         * @param x Colonne de la case modifiée.
+         * @param y Ligne de la case modifiée.
+         */
+        void cellChanged(int x, int y);
 
     public:
         /**
@@ -62,7 +131,8 @@ class Board {
          * - 5–9 joueurs : plateau 30x30 ;
          * - sinon : plateau invalide (0x0) et message d’erreur.
          *
-         * Les grilles `grid` et `ownerGrid` sont réallouées et remises à zéro.
+         * Les grilles `grid` et `ownerGrid` sont réallouées et remises à zéro,
+         * toutes les cases deviennent neutres et les ancres sont vidées.
          *
          * @param numberOfPlayers Nombre de joueurs.
          */
@@ -82,6 +152,15 @@ class Board {
          */
         void placeBonus(int numberOfPlayers);
 
+        /**
+         * @brief Place les bonus comme placeBonus(int), tirés par un générateur donné :
+         *        même graine, même disposition (réglage et livre d’ouvertures reproductibles).
+         *
+         * @param numberOfPlayers Nombre de joueurs.
+         * @param rng Générateur.
+         */
+        void placeBonus(int numberOfPlayers, std::mt19937& rng);
+
         /**
          * @brief Affiche la grille brute sur la sortie standard (pour débogage).
          *
@@ -94,6 +173,7 @@ class Board {
          * @brief Pose une case de territoire ('#') pour un joueur.
          *
          * La case doit être vide ('.') et à l’intérieur du plateau.
+         * Les ancres de la case et de ses voisines sont mises à jour.
          *
          * @param x Coordonnée de colonne.
          * @param y Coordonnée de ligne.
@@ -105,7 +185,8 @@ class Board {
          * @brief Pose une pierre ('X') 1x1 sur le plateau.
          *
          * La case doit être vide. La pierre n’appartient à aucun joueur
-         * (ownerGrid = 0) et bloque les placements futurs.
+         * (ownerGrid = 0) et bloque les placements futurs. La case quitte la frontière
+         * de tous les joueurs.
          *
          * @param x Coordonnée de colonne.
          * @param y Coordonnée de ligne.
@@ -160,6 +241,48 @@ class Board {
          */
         const std::vector<std::vector<int>>& getOwnerGrid() const { return ownerGrid; };
 
+        /**
+         * @brief Cases vides qu’aucun territoire ne touche.
+         *
+         * @return Masque par ligne (bit x de la ligne y).
+         */
+        const BitGrid& getNeutral() const { return neutral; }
+
+        /**
+         * @brief Ancres d’un joueur : cases vides voisines de son territoire et d’aucun adversaire.
+         *
+         * Tout placement légal du joueur recouvre au moins une de ces cases, et toutes ses
+         * cases sont dans getNeutral() | getAnchors(playerId).
+         *
+         * @param playerId Identifiant du joueur.
+         * @return Masque par ligne (vide si le joueur n’a aucun territoire).
+         */
+        const BitGrid& getAnchors(int playerId) const;
+
+        /**
+         * @brief Nombre d’ancres d’un joueur.
+         * @param playerId Identifiant du joueur.
+         * @return Nombre de cases de getAnchors(playerId).
+         */
+        int anchorCount(int playerId) const;
+
+        /**
+         * @brief Version courante du plateau (incrémentée à chaque case modifiée).
+         */
+        std::uint64_t getVersion() const { return version; }
+
+        /**
+         * @brief Zones modifiées depuis une version donnée.
+         *
+         * Chaque zone englobe des cases modifiées et leurs voisines orthogonales : la légalité
+         * d’un placement ne peut avoir changé que s’il recouvre l’une de ces zones.
+         *
+         * @param since Version de référence (typiquement celle d’un calcul mis en cache).
+         * @param out Zones modifiées après `since` (vidé au préalable).
+         * @return false si l’historique ne remonte pas jusqu’à `since` (tout recalculer).
+         */
+        bool dirtySince(std::uint64_t since, std::vector<DirtyRect>& out) const;
+
         /**
          * @brief Accède aux bonus placés sur le plateau.
          *
@@ -2,6 +2,7 @@
 #define DISPLAY_BOARD_HPP_INCLUDED
 #include "../Board/Board.hpp"
 #include <iostream>
+#include <vector>
 #include "Game/Game.hpp"
 
 
@@ -34,6 +35,21 @@ class Display_Board {
         */
         explicit Display_Board(const Board& board);
 
+        /**
+         * @struct Overlay
+         * @brief Marques superposées au plateau (analyses, aides de placement).
+         *
+         * Une marque remplace le contenu de toute case sauf un bonus (une origine de
+         * placement peut tomber sur une case possédée). Indices [ligne][colonne] ; des
+         * tableaux vides ou plus petits que le plateau laissent les cases concernées inchangées.
+         */
+        struct Overlay {
+            /// Caractère affiché à la place de '.' ('\0' : aucune marque).
+            std::vector<std::vector<char>> marks;
+            /// Siège (indice du joueur) dont la couleur colore la marque, -1 : sans couleur.
+            std::vector<std::vector<int>> seats;
+        };
+
         /**
         * @brief Affiche la grille complète du plateau, colorée selon les joueurs.
         *
@@ -44,9 +60,20 @@ class Display_Board {
         */
         void display(const Game& game) const;
 
+        /**
+        * @brief Affiche la grille avec des marques superposées.
+        *
+        * @param game Voir display(const Game&).
+        * @param overlay Marques et couleurs des cases.
+        */
+        void display(const Game& game, const Overlay& overlay) const;
+
     private:
         const Board& board;
 
+        /** @brief Affichage commun ; overlay peut être nul. */
+        void render(const Game& game, const Overlay* overlay) const;
+
         /**
          * @brief Affiche la bordure supérieure du plateau (ligne +---…+).
          * @param cols Nombre de colonnes du plateau.
@@ -0,0 +1,92 @@
+#ifndef BATCHLEGALITY_HPP_INCLUDED
+#define BATCHLEGALITY_HPP_INCLUDED
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Engine/BitGrid.hpp"
+#include "Engine/MoveGenerator.hpp"
+#include "Engine/Shape.hpp"
+
+/**
+ * @class BatchLegality
+ * @brief Validation groupée : origines légales de toutes les orientations d’un lot de
+ *        tuiles (la tuile en main et la fenêtre d’aperçu : ~48 formes) en un seul balayage.
+ *
+ * Les masques du joueur sont lus une seule fois par motif de ligne : les orientations du
+ * lot partagent beaucoup de lignes de forme (« ### », « # », « ## »…), et pour chaque
+ * motif distinct les origines où cette ligne tient sur des cases libres (ET des
+ * `free[r] >> dx`) et celles où elle touche une ancre (OU des `anchors[r] >> dx`) sont
+ * tabulées pour tout le plateau. Chaque orientation ne combine plus que ses lignes, une
+ * opération par ligne de forme au lieu d’une par case (mêmes règles que
+ * MoveGenerator::legalRow).
+ * Seules les lignes dont une forme peut toucher une ancre sont balayées, et une orientation
+ * présente plusieurs fois dans le lot (même forme dans la fenêtre) n’est testée qu’une fois.
+ *
+ * Les formes sont référencées, pas copiées : elles doivent survivre au lot.
+ */
+class BatchLegality {
+public:
+    /** @brief Vide le lot. */
+    void clear();
+
+    /**
+     * @brief Ajoute une tuile (toutes ses orientations) au lot.
+     * @param shape Orientations de la tuile.
+     * @return Indice de la tuile dans le lot.
+     */
+    int add(const ShapeSet& shape);
+
+    /**
+     * @brief Calcule les origines légales de tout le lot pour un joueur.
+     * @param masks Masques du joueur.
+     */
+    void run(const PlacementMasks& masks);
+
+    /** @brief Nombre de tuiles du lot. */
+    int size() const { return static_cast<int>(shapes_.size()); }
+
+    /** @brief Tuile d’indice i du lot. */
+    const ShapeSet& shape(int i) const { return *shapes_[i]; }
+
+    /** @brief Origines légales d’une orientation (carte de légalité). */
+    const BitGrid& origins(int i, int orientation) const;
+
+    /** @brief Nombre de placements légaux d’une tuile (toutes orientations). */
+    int count(int i) const;
+
+    /** @brief Indique si une tuile a au moins un placement légal. */
+    bool any(int i) const { return count(i) > 0; }
+
+    /**
+     * @brief Énumère les placements légaux d’une tuile (ordre de MoveGenerator::generate).
+     * @param i Indice de la tuile.
+     * @param out Liste de sortie (vidée au préalable).
+     */
+    void moves(int i, MoveList& out) const;
+
+private:
+    /**
+     * @struct Kernel
+     * @brief Orientation distincte du lot : motif (indice dans patterns_) de chaque ligne.
+     */
+    struct Kernel {
+        const Orientation* orientation = nullptr;
+        std::vector<std::uint16_t> patterns;
+        BitGrid origins{};
+    };
+
+    std::vector<const ShapeSet*> shapes_;
+    /// Pour chaque tuile, indice du noyau de chacune de ses orientations.
+    std::vector<std::vector<int>> kernelOf_;
+    std::vector<Kernel> kernels_;
+    int maxHeight_ = 0;
+    /// Motifs de ligne distincts du lot (bit dx).
+    std::vector<Row> patterns_;
+    /// Par motif : origines où la ligne r tient sur des cases libres.
+    std::vector<BitGrid> freeFit_;
+    /// Par motif : origines où la ligne r touche une ancre.
+    std::vector<BitGrid> anchorHit_;
+};
+
+#endif // BATCHLEGALITY_HPP_INCLUDED
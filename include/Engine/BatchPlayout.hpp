@@ -0,0 +1,87 @@
+#ifndef BATCHPLAYOUT_HPP_INCLUDED
+#define BATCHPLAYOUT_HPP_INCLUDED
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Engine/BitGrid.hpp"
+#include "Engine/FastRng.hpp"
+#include "Engine/Position.hpp"
+#include "Engine/SegmentTable.hpp"
+#include "Engine/TileBag.hpp"
+
+/// Parties simulées ensemble : une par voie d’un registre AVX2 (8 mots de 32 bits).
+constexpr int kBatchLanes = 8;
+
+/**
+ * @class BatchPlayout
+ * @brief Parties simulées en masse (mêmes règles que Playout), kBatchLanes parties à la fois.
+ *
+ * Les parties sont jouées par groupes de kBatchLanes, en parallèle de données : à chaque tour,
+ * les lignes des masques que lit la validation (cases neutres et ancres du siège à jouer) sont
+ * entrelacées, chaque ligne devenant un vecteur des kBatchLanes parties. Un plateau de 30x30
+ * tient en 30 mots de 32 bits : le mot d’une partie est une voie du vecteur.
+ *
+ * Les parties d’un groupe avancent au même pas : même siège à jouer et même tuile tirée à chaque
+ * tour (seule la pioche est commune, les placements sont tirés partie par partie). La validation
+ * est alors la même suite d’opérations pour toutes les voies : tables `fit` / `hit` des suites
+ * de cases et combinaison des segments de chaque orientation (SegmentTable, comme Playout),
+ * décompte des origines légales par voie. Ce noyau existe en AVX2 (un registre = le groupe) et
+ * en version scalaire (boucles sur les voies) ; le premier est choisi si le processeur le permet.
+ * Le reste des règles n’est pas réécrit : la pose et la capture des bonus sont celles de
+ * Position, la pierre du Rock bonus et la phase 1x1 finale celles de Playout (playRock, finish).
+ *
+ * Tirer la même tuile dans les kBatchLanes parties d’un groupe corrèle leurs résultats : un
+ * groupe ne vaut pas kBatchLanes échantillons indépendants. Pour des estimations indépendantes,
+ * répartir les positions de départ entre les groupes. Aucun moteur de jeu ne s’en sert : il
+ * est mesuré par le banc d’essai (`bench simd`).
+ */
+class BatchPlayout {
+public:
+    /** @brief Moteur vide (aucune tuile). */
+    BatchPlayout() = default;
+
+    /** @brief Moteur pour un catalogue (même indice que InitTiles::all()). */
+    explicit BatchPlayout(const std::vector<ShapeSet>& catalog);
+
+    /** @brief Lit les segments d’un nouveau catalogue. */
+    void setCatalog(const std::vector<ShapeSet>& catalog);
+
+    /** @brief Indique si le processeur exécute AVX2. */
+    static bool avx2Available();
+
+    /** @brief Choisit le noyau AVX2 (s’il est disponible) ou le noyau scalaire. */
+    void setAvx2(bool enabled) { avx2_ = enabled && avx2Available(); }
+
+    /** @brief Indique si le noyau AVX2 est utilisé. */
+    bool avx2() const { return avx2_; }
+
+    /**
+     * @brief Joue une partie depuis chaque position jusqu’au bout (phase finale comprise).
+     *
+     * Le siège à jouer de chaque position tire sa tuile ; les positions consécutives forment
+     * les groupes de kBatchLanes parties.
+     *
+     * @param starts Positions de départ : même plateau, même nombre de sièges, même manche et
+     *        même siège à jouer.
+     * @param bag Pioche (copiée et complétée au hasard pour chaque groupe).
+     * @param rng Générateur.
+     * @param scores Score final de chaque partie (même indice que starts).
+     * @throws std::invalid_argument si les positions ne peuvent pas avancer au même pas.
+     */
+    void run(const std::vector<Position>& starts, const TileBag& bag, FastRng& rng,
+             std::vector<std::array<SeatScore, kMaxPlayers>>& scores) const;
+
+private:
+    /// Parties d’un groupe et leurs masques entrelacés, défini dans BatchPlayout.cpp.
+    struct Group;
+
+    /** @brief Joue un coup tiré uniformément dans chaque partie du groupe. */
+    void playRandom_(Group& group, int tile, FastRng& rng) const;
+
+    /// Segments des orientations du catalogue (même table que Playout).
+    SegmentTable table_;
+    bool avx2_ = avx2Available();
+};
+
+#endif // BATCHPLAYOUT_HPP_INCLUDED
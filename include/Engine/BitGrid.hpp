@@ -0,0 +1,108 @@
+#ifndef BITGRID_HPP_INCLUDED
+#define BITGRID_HPP_INCLUDED
+
+#include <array>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * @file BitGrid.hpp
+ * @brief Représentation du plateau en masques de bits par ligne.
+ *
+ * Une ligne du plateau est un mot de 32 bits : le bit `x` de la ligne `y` représente
+ * la case (x, y). Les plateaux du jeu font au plus 30x30, d’où `kMaxSide = 32`.
+ * Ces masques servent de base aux noyaux rapides (génération de coups, analyses).
+ */
+
+/// Une ligne du plateau (bit x = colonne x).
+using Row = std::uint32_t;
+
+/// Côté maximal d’un plateau représentable.
+constexpr int kMaxSide = 32;
+
+/// Plateau complet sous forme de masques de lignes.
+using BitGrid = std::array<Row, kMaxSide>;
+
+/**
+ * @brief Masque des `cols` premières colonnes.
+ * @param cols Nombre de colonnes (0..32).
+ * @return Mot dont les `cols` bits de poids faible sont à 1.
+ */
+inline Row columnsMask(int cols) {
+    return cols >= kMaxSide ? ~Row(0) : ((Row(1) << cols) - 1);
+}
+
+/**
+ * @brief Indice du bit de poids faible à 1.
+ * @param r Mot non nul.
+ * @return Position du bit (0..31).
+ */
+inline int lowestBit(Row r) {
+#if defined(_MSC_VER)
+    unsigned long idx;
+    _BitScanForward(&idx, r);
+    return static_cast<int>(idx);
+#else
+    return __builtin_ctz(r);
+#endif
+}
+
+/**
+ * @brief Nombre de bits à 1 d’un mot.
+ * Sans l’instruction POPCNT (cible x86-64 de base), __builtin_popcount devient un appel
+ * de bibliothèque : le calcul par tranches de bits, en ligne, est alors plus rapide.
+ *
+ * @param r Mot quelconque.
+ * @return Population du mot.
+ */
+inline int popCount(Row r) {
+#if defined(_MSC_VER)
+    return static_cast<int>(__popcnt(r));
+#elif defined(__POPCNT__) || !(defined(__x86_64__) || defined(__i386__))
+    return __builtin_popcount(r);
+#else
+    r = r - ((r >> 1) & 0x55555555u);
+    r = (r & 0x33333333u) + ((r >> 2) & 0x33333333u);
+    r = (r + (r >> 4)) & 0x0F0F0F0Fu;
+    return static_cast<int>((r * 0x01010101u) >> 24);
+#endif
+}
+
+/**
+ * @brief Indice du k-ième bit à 1 d’un mot (0 : le plus faible), pour tirer une origine
+ *        au hasard dans une ligne d’origines légales.
+ * @param r Mot ayant au moins k + 1 bits à 1.
+ * @param k Rang du bit cherché.
+ * @return Position du bit (0..31).
+ */
+inline int selectBit(Row r, int k) {
+    while (k-- > 0) r &= r - 1;
+    return lowestBit(r);
+}
+
+/**
+ * @brief Dilatation orthogonale (4-voisinage) d’un masque, restreinte au plateau.
+ *
+ * Le résultat contient les cases du masque et leurs voisines haut, bas, gauche, droite.
+ *
+ * @param src Masque source.
+ * @param rows Nombre de lignes du plateau.
+ * @param cols Nombre de colonnes du plateau.
+ * @return Masque dilaté.
+ */
+inline BitGrid dilate(const BitGrid& src, int rows, int cols) {
+    BitGrid out{};
+    const Row cm = columnsMask(cols);
+    for (int y = 0; y < rows; ++y) {
+        Row r = src[y] | (src[y] << 1) | (src[y] >> 1);
+        if (y > 0) r |= src[y - 1];
+        if (y + 1 < rows) r |= src[y + 1];
+        out[y] = r & cm;
+    }
+    return out;
+}
+
+#endif // BITGRID_HPP_INCLUDED
@@ -0,0 +1,102 @@
+#ifndef COVERAGE_HPP_INCLUDED
+#define COVERAGE_HPP_INCLUDED
+
+#include <array>
+#include <vector>
+#include "Engine/BitGrid.hpp"
+#include "Engine/MoveGenerator.hpp"
+#include "Engine/Position.hpp"
+#include "Engine/Shape.hpp"
+
+/**
+ * @class Coverage
+ * @brief Carte de couverture : pour chaque case et chaque siège, nombre de placements
+ *        légaux (toutes orientations des tuiles données) qui la recouvrent.
+ *
+ * Convolution par masques : les origines légales d’une ligne (MoveGenerator::legalRow),
+ * décalées de chaque case (dx, dy) de l’orientation, sont ajoutées à la ligne y + dy de
+ * compteurs en tranches de bits (plan k = bit k du compteur de chaque case) : une addition
+ * traite 32 cases à la fois, la retenue ne se propageant que sur quelques plans.
+ *
+ * Mise à jour incrémentale : update() compare les masques de placement de la position à
+ * ceux du dernier calcul. Si les lignes [d0, d1] d’un siège ont changé, seules ses origines
+ * des lignes [d0 − h + 1, d1] peuvent changer (h : hauteur de l’orientation) ; elles sont
+ * réévaluées avant et après, et seule la différence est retirée ou ajoutée aux compteurs.
+ */
+class Coverage {
+public:
+    /// Plans des compteurs (couverture maximale 2^kPlanes − 1 par case).
+    static constexpr int kPlanes = 16;
+
+    /**
+     * @struct Features
+     * @brief Caractéristiques numériques d’un siège (évaluation).
+     */
+    struct Features {
+        /// Cases recouvertes par au moins un placement.
+        int coveredCells = 0;
+        /// Cases recouvertes par ce siège et par aucun autre.
+        int exclusiveCells = 0;
+        /// Somme des couvertures (placements × cases de la tuile).
+        long totalCoverage = 0;
+        /// Couverture maximale d’une case.
+        int maxCoverage = 0;
+    };
+
+    /**
+     * @brief Carte pour un ensemble de tuiles (la tuile en main seule, ou tout le catalogue).
+     * @param shapes Orientations des tuiles comptées.
+     */
+    explicit Coverage(std::vector<ShapeSet> shapes);
+
+    /** @brief Calcule toute la carte pour une position. */
+    void compute(const Position& position);
+
+    /**
+     * @brief Met la carte à jour après des poses (tuiles, cases, pierres) depuis le
+     *        dernier calcul ; recalcul complet si le plateau ou les sièges diffèrent.
+     */
+    void update(const Position& position);
+
+    /** @brief Couverture de la case (x, y) pour un siège. */
+    int count(int seat, int x, int y) const;
+
+    /** @brief Cases de couverture non nulle d’un siège. */
+    BitGrid covered(int seat) const;
+
+    /**
+     * @brief Export pour l’affichage : couverture par case, indices [ligne][colonne].
+     */
+    std::vector<std::vector<int>> grid(int seat) const;
+
+    /** @brief Caractéristiques numériques d’un siège. */
+    Features features(int seat) const;
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    int numSeats() const { return seats_; }
+
+private:
+    /// Compteurs en tranches de bits d’un siège.
+    using Planes = std::array<BitGrid, kPlanes>;
+
+    std::vector<ShapeSet> shapes_;
+    int rows_ = 0;
+    int cols_ = 0;
+    int seats_ = 0;
+    std::array<Planes, kMaxPlayers> planes_{};
+    /// Masques de placement du dernier calcul.
+    std::array<PlacementMasks, kMaxPlayers> masks_{};
+
+    /** @brief Recalcule les lignes [r0, r1] des compteurs d’un siège. */
+    void rebuildRows_(int seat, int r0, int r1);
+
+    /**
+     * @brief Ajoute (sign > 0) ou retire (sign < 0) les cases des placements d’origines
+     *        `origins` (ligne y) aux compteurs d’un siège, sur les lignes [r0, r1] seulement.
+     */
+    void addOrigins_(int seat, const Orientation& o, int y, Row origins, int sign,
+                     int r0 = 0, int r1 = kMaxSide - 1);
+};
+
+#endif // COVERAGE_HPP_INCLUDED
@@ -0,0 +1,63 @@
+#ifndef FASTRNG_HPP_INCLUDED
+#define FASTRNG_HPP_INCLUDED
+
+#include <cstdint>
+#include <limits>
+
+/**
+ * @class FastRng
+ * @brief Générateur pseudo-aléatoire rapide (xoshiro128**) pour les parties simulées.
+ *
+ * État de 16 octets (contre 2,5 Ko pour std::mt19937), quelques opérations par tirage.
+ * Respecte l’interface URBG : utilisable avec TileBag::draw() et la bibliothèque standard.
+ * below() tire un entier dans [0, n) par multiplication (sans division) ; le biais, de
+ * l’ordre de n / 2^32, est négligeable pour les tailles du jeu.
+ */
+class FastRng {
+public:
+    using result_type = std::uint32_t;
+
+    /** @brief Générateur initialisé par une graine. */
+    explicit FastRng(std::uint64_t seed = 1) { this->seed(seed); }
+
+    /** @brief Réinitialise l’état (SplitMix64 de la graine : aucun état nul). */
+    void seed(std::uint64_t seed) {
+        for (int i = 0; i < 4; i += 2) {
+            seed += 0x9E3779B97F4A7C15ull;
+            std::uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            z ^= z >> 31;
+            s_[i] = static_cast<std::uint32_t>(z);
+            s_[i + 1] = static_cast<std::uint32_t>(z >> 32);
+        }
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    /** @brief Mot suivant. */
+    result_type operator()() {
+        const std::uint32_t result = rotl_(s_[1] * 5, 7) * 9;
+        const std::uint32_t t = s_[1] << 9;
+        s_[2] ^= s_[0];
+        s_[3] ^= s_[1];
+        s_[1] ^= s_[2];
+        s_[0] ^= s_[3];
+        s_[2] ^= t;
+        s_[3] = rotl_(s_[3], 11);
+        return result;
+    }
+
+    /** @brief Entier uniforme dans [0, n) (n > 0). */
+    std::uint32_t below(std::uint32_t n) {
+        return static_cast<std::uint32_t>((static_cast<std::uint64_t>((*this)()) * n) >> 32);
+    }
+
+private:
+    std::uint32_t s_[4];
+
+    static std::uint32_t rotl_(std::uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+};
+
+#endif // FASTRNG_HPP_INCLUDED
@@ -0,0 +1,157 @@
+#ifndef MOVEGENERATOR_HPP_INCLUDED
+#define MOVEGENERATOR_HPP_INCLUDED
+
+#include <cstdint>
+#include <vector>
+#include "Engine/BitGrid.hpp"
+#include "Engine/Shape.hpp"
+
+class Board;
+
+/**
+ * @struct Move
+ * @brief Placement compact : orientation (indice dans un ShapeSet) et origine (x, y).
+ */
+struct Move {
+    /// Indice de l’orientation dans ShapeSet::orientations().
+    std::uint8_t orientation = 0;
+    /// Colonne de l’origine.
+    std::uint8_t x = 0;
+    /// Ligne de l’origine.
+    std::uint8_t y = 0;
+};
+
+/**
+ * @class MoveList
+ * @brief Liste de coups à capacité réservée une fois pour toutes.
+ *
+ * La capacité couvre le pire cas (8 orientations × toutes les origines d’un plateau 32x32),
+ * si bien que remplir la liste n’alloue jamais : la liste peut être réutilisée d’un appel
+ * à l’autre via clear().
+ */
+class MoveList {
+public:
+    /// Capacité réservée (pire cas).
+    static constexpr std::size_t kCapacity = 8 * kMaxSide * kMaxSide;
+
+    MoveList() { moves_.reserve(kCapacity); }
+
+    /** @brief Vide la liste (la capacité est conservée). */
+    void clear() { moves_.clear(); }
+
+    /** @brief Ajoute un coup. */
+    void push(const Move& m) { moves_.push_back(m); }
+
+    /** @brief Nombre de coups. */
+    std::size_t size() const { return moves_.size(); }
+
+    /** @brief Indique si la liste est vide. */
+    bool empty() const { return moves_.empty(); }
+
+    /** @brief Accès au i-ème coup. */
+    const Move& operator[](std::size_t i) const { return moves_[i]; }
+
+    std::vector<Move>::const_iterator begin() const { return moves_.begin(); }
+    std::vector<Move>::const_iterator end() const { return moves_.end(); }
+
+private:
+    std::vector<Move> moves_;
+};
+
+/**
+ * @struct PlacementMasks
+ * @brief Masques de placement d’un joueur.
+ *
+ * - `free`    : cases vides ('.') non adjacentes à un adversaire ;
+ * - `anchors` : cases de `free` adjacentes au territoire du joueur.
+ *
+ * Un placement est légal (mêmes règles que Game::canPlaceFootprint) si et seulement si
+ * toutes ses cases sont dans `free` et au moins une est dans `anchors`.
+ */
+struct PlacementMasks {
+    int rows = 0;
+    int cols = 0;
+    BitGrid free{};
+    BitGrid anchors{};
+};
+
+/**
+ * @class MoveGenerator
+ * @brief Génère les placements légaux d’une tuile pour un joueur, par masques de bits.
+ *
+ * Pour une orientation donnée, les origines légales d’une ligne `y` sont calculées d’un coup
+ * sur les 32 colonnes : intersection des lignes `free` décalées de chaque case de la forme,
+ * et union des lignes `anchors` décalées. Le coût est d’environ
+ * orientations × lignes × cases opérations sur des mots, sans allocation.
+ */
+class MoveGenerator {
+public:
+    /**
+     * @brief Construit les masques de placement d’un joueur à partir du plateau.
+     * @param board Plateau.
+     * @param playerId Identifiant du joueur.
+     * @return Masques `free` / `anchors`.
+     */
+    static PlacementMasks masksFor(const Board& board, int playerId);
+
+    /**
+     * @brief Origines légales d’une orientation.
+     * @param masks Masques du joueur.
+     * @param o Orientation testée.
+     * @return Bit x de la ligne y à 1 si le placement d’origine (x, y) est légal.
+     */
+    static BitGrid legalOrigins(const PlacementMasks& masks, const Orientation& o);
+
+    /**
+     * @brief Origines légales d’une orientation pour une seule ligne.
+     * @param masks Masques du joueur.
+     * @param o Orientation.
+     * @param y Ligne de l’origine (doit vérifier y + hauteur <= rows).
+     * @param xMask Masque des colonnes d’origine admissibles (largeur de la forme).
+     * @return Masque des origines légales de la ligne.
+     */
+    static Row legalRow(const PlacementMasks& masks, const Orientation& o, int y, Row xMask);
+
+    /**
+     * @brief Ajoute à `out` tous les placements légaux d’une tuile (toutes orientations).
+     * @param masks Masques du joueur.
+     * @param shape Orientations de la tuile.
+     * @param out Liste de sortie (vidée au préalable).
+     */
+    static void generate(const PlacementMasks& masks, const ShapeSet& shape, MoveList& out);
+
+    /**
+     * @brief Variante partant directement du plateau.
+     * @param board Plateau.
+     * @param playerId Identifiant du joueur.
+     * @param shape Orientations de la tuile.
+     * @param out Liste de sortie (vidée au préalable).
+     */
+    static void generate(const Board& board, int playerId, const ShapeSet& shape, MoveList& out);
+
+    /**
+     * @brief Nombre de placements légaux, sans les énumérer.
+     * @param masks Masques du joueur.
+     * @param shape Orientations de la tuile.
+     * @return Nombre de placements légaux.
+     */
+    static std::size_t countMoves(const PlacementMasks& masks, const ShapeSet& shape);
+
+    /**
+     * @brief Indique si au moins un placement est légal (arrêt au premier trouvé).
+     * @param masks Masques du joueur.
+     * @param shape Orientations de la tuile.
+     * @return true si la tuile peut être posée.
+     */
+    static bool hasAnyMove(const PlacementMasks& masks, const ShapeSet& shape);
+
+    /**
+     * @brief Empreinte absolue d’un coup (cases occupées).
+     * @param shape Orientations de la tuile.
+     * @param m Coup.
+     * @return Coordonnées (x, y), identiques à `Tile::footprint(m.x, m.y, rot, flip)`.
+     */
+    static std::vector<std::pair<int,int>> footprint(const ShapeSet& shape, const Move& m);
+};
+
+#endif // MOVEGENERATOR_HPP_INCLUDED
@@ -0,0 +1,108 @@
+#ifndef PLACEMENTCACHE_HPP_INCLUDED
+#define PLACEMENTCACHE_HPP_INCLUDED
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Board/Board.hpp"
+#include "Engine/MoveGenerator.hpp"
+#include "Engine/Shape.hpp"
+
+/**
+ * @class PlacementCache
+ * @brief Cache des origines légales par joueur et par orientation, invalidé par zones.
+ *
+ * Pour chaque (joueur, tuile, orientation), le cache conserve la grille des origines
+ * légales et la version du plateau à laquelle elle a été calculée. À la requête suivante,
+ * seules les origines dont la forme recouvre une zone modifiée depuis (Board::dirtySince,
+ * empreinte + halo) sont revalidées ; le reste est réutilisé tel quel. Si l’historique du
+ * plateau ne remonte pas assez loin, l’entrée est recalculée entièrement.
+ *
+ * Le cache est lié à un plateau (référence) ; il n’est pas thread-safe.
+ */
+class PlacementCache {
+public:
+    /**
+     * @struct Stats
+     * @brief Compteurs d’activité du cache.
+     */
+    struct Stats {
+        /// Entrées recalculées entièrement.
+        std::size_t fullRebuilds = 0;
+        /// Entrées mises à jour par zones.
+        std::size_t incrementalUpdates = 0;
+        /// Entrées réutilisées sans aucune revalidation.
+        std::size_t hits = 0;
+        /// Lignes d’origines revalidées (toutes mises à jour confondues).
+        std::size_t rowsRevalidated = 0;
+    };
+
+    /**
+     * @brief Lie le cache à un plateau.
+     * @param board Plateau observé (doit survivre au cache).
+     */
+    explicit PlacementCache(const Board& board) : board_(board) {}
+
+    /**
+     * @brief Origines légales d’une orientation pour un joueur, à jour du plateau.
+     * @param playerId Identifiant du joueur.
+     * @param shape Orientations de la tuile.
+     * @param orientation Indice d’orientation dans `shape`.
+     * @return Grille des origines légales (valide jusqu’au prochain appel).
+     */
+    const BitGrid& legalOrigins(int playerId, const ShapeSet& shape, int orientation);
+
+    /**
+     * @brief Énumère les placements légaux d’une tuile à partir du cache.
+     * @param playerId Identifiant du joueur.
+     * @param shape Orientations de la tuile.
+     * @param out Liste de sortie (vidée au préalable).
+     */
+    void generate(int playerId, const ShapeSet& shape, MoveList& out);
+
+    /**
+     * @brief Nombre de placements légaux d’une tuile à partir du cache.
+     * @param playerId Identifiant du joueur.
+     * @param shape Orientations de la tuile.
+     * @return Nombre de placements légaux.
+     */
+    std::size_t countMoves(int playerId, const ShapeSet& shape);
+
+    /** @brief Vide le cache. */
+    void clear() { entries_.clear(); slots_.clear(); }
+
+    /** @brief Compteurs d’activité. */
+    const Stats& stats() const { return stats_; }
+
+private:
+    /**
+     * @struct Entry
+     * @brief Origines légales d’une orientation et version du plateau correspondante.
+     */
+    struct Entry {
+        std::uint64_t version = 0;
+        bool valid = false;
+        /// Nombre d’origines légales (population de `origins`).
+        std::size_t count = 0;
+        BitGrid origins{};
+    };
+
+    /**
+     * @brief Met à jour les entrées d’une tuile pour un joueur et les renvoie.
+     * @param playerId Identifiant du joueur.
+     * @param shape Orientations de la tuile.
+     * @return Entrées (une par orientation) à jour.
+     */
+    std::vector<Entry>& refresh(int playerId, const ShapeSet& shape);
+
+    const Board& board_;
+    /// Indice attribué à chaque tuile rencontrée.
+    std::unordered_map<std::string, std::uint32_t> slots_;
+    /// Entrées par clé (joueur << 32 | indice de tuile), une par orientation.
+    std::unordered_map<std::uint64_t, std::vector<Entry>> entries_;
+    std::vector<DirtyRect> dirty_;
+    Stats stats_;
+};
+
+#endif // PLACEMENTCACHE_HPP_INCLUDED
@@ -0,0 +1,78 @@
+#ifndef PLAYOUT_HPP_INCLUDED
+#define PLAYOUT_HPP_INCLUDED
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Engine/BitGrid.hpp"
+#include "Engine/FastRng.hpp"
+#include "Engine/Position.hpp"
+#include "Engine/SegmentTable.hpp"
+#include "Engine/TileBag.hpp"
+
+/**
+ * @class Playout
+ * @brief Partie simulée jusqu’à la fin de la 9e manche par coups légaux uniformes, puis
+ *        phase 1x1 finale : moteur des simulations de MctsAgent et mesure de référence.
+ *
+ * Mêmes règles que la boucle de Game, sans sortie ni allocation : la position (Position,
+ * masques de bits) et la pioche (TileBag) sont copiées par l’appelant puis jouées sur place,
+ * les tirages utilisent FastRng.
+ *
+ * Les orientations du catalogue sont lues en « segments » (SegmentTable) : chaque ligne d’une
+ * forme est découpée en suites de cases contiguës (dx, longueur), presque toujours une seule.
+ * À chaque tour, les origines où une suite de longueur L tient sur des cases libres
+ * (ET des `free >> i`, i < L) et celles où elle touche une ancre sont tabulées une fois pour
+ * toutes les longueurs de la tuile, par récurrence sur L ; une orientation ne coûte ensuite
+ * qu’une opération par segment, au lieu d’une par case.
+ *
+ * Règles des tours simulés (comme MctsAgent) :
+ * - Rock bonus : la pierre est posée sur une ancre adverse tirée au hasard ;
+ * - placement tiré uniformément parmi les placements légaux (aucun : tour passé) ;
+ * - phase finale : chaque siège avec un coupon achète une case 1x1 sur une de ses ancres.
+ */
+class Playout {
+public:
+    /** @brief Moteur vide (aucune tuile). */
+    Playout() = default;
+
+    /** @brief Moteur pour un catalogue (même indice que InitTiles::all()). */
+    explicit Playout(const std::vector<ShapeSet>& catalog);
+
+    /** @brief Précompile un nouveau catalogue (capacité conservée). */
+    void setCatalog(const std::vector<ShapeSet>& catalog);
+
+    /**
+     * @brief Joue la partie jusqu’au bout.
+     * @param pos Position, le siège `pos.toMove()` ayant déjà tiré `tile` (modifiée sur place).
+     * @param bag Pioche (modifiée sur place).
+     * @param tile Tuile en main du siège à jouer (-1 : manches terminées, phase finale seule).
+     * @param rng Générateur.
+     * @return Score final de chaque siège (numSeats() premières valeurs remplies).
+     */
+    std::array<SeatScore, kMaxPlayers> run(Position& pos, TileBag& bag, int tile, FastRng& rng) const;
+
+    /**
+     * @brief Joue un coup uniforme de la tuile pour le siège à jouer (sans finir le tour).
+     * @return false si la tuile n’a aucun placement légal.
+     */
+    bool playRandom(Position& pos, int tile, FastRng& rng) const;
+
+    /** @brief Pose la pierre du Rock bonus du siège à jouer, s’il en a une, sur une ancre adverse. */
+    static void playRock(Position& pos, FastRng& rng);
+
+    /**
+     * @brief Phase 1x1 finale puis score de chaque siège.
+     * @return Score final de chaque siège (numSeats() premières valeurs remplies).
+     */
+    static std::array<SeatScore, kMaxPlayers> finish(Position& pos, FastRng& rng);
+
+    /** @brief Segments des orientations du catalogue. */
+    const SegmentTable& table() const { return table_; }
+
+private:
+    /// Segments des orientations du catalogue.
+    SegmentTable table_;
+};
+
+#endif // PLAYOUT_HPP_INCLUDED
@@ -0,0 +1,257 @@
+#ifndef POSITION_HPP_INCLUDED
+#define POSITION_HPP_INCLUDED
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Engine/BitGrid.hpp"
+#include "Engine/MoveGenerator.hpp"
+#include "Engine/Shape.hpp"
+
+class Board;
+class Player;
+
+/// Nombre maximal de joueurs d’une partie.
+constexpr int kMaxPlayers = 9;
+
+/// Nombre maximal de cases bonus (28 pour 9 joueurs).
+constexpr int kMaxBonuses = 32;
+
+/// Nombre de manches d’une partie complète.
+constexpr int kMaxRounds = 9;
+
+/**
+ * @enum BonusKind
+ * @brief Type d’une case bonus ('E', 'R', 'S').
+ */
+enum class BonusKind : std::uint8_t { Exchange, Rock, Steal };
+
+/**
+ * @struct SeatScore
+ * @brief Score final d’un siège : plus grand carré, puis nombre de cases.
+ */
+struct SeatScore {
+    int maxSquare = 0;
+    int cellCount = 0;
+};
+
+/**
+ * @class Position
+ * @brief État de partie compact pour la simulation (recherche, parties aléatoires).
+ *
+ * Toute la partie tient dans des tableaux de taille fixe (environ 3 Ko) : une copie ne fait
+ * aucune allocation. Les joueurs sont désignés par leur siège (0..n-1, ordre de jeu) ;
+ * `playerId(seat)` redonne l’identifiant de Player.
+ *
+ * Les masques (cases vides, territoire, cases neutres et ancres de chaque siège) suivent les
+ * mêmes règles que Board : poser une tuile ne touche que les lignes de la tuile et leur halo.
+ * La capture de bonus et ses effets (coupon, pierre à poser) sont appliqués comme dans
+ * Board::checkBonusCapture, sans passer par Game.
+ *
+ * Pour chaque bonus et chaque siège, les côtés possédés et bloqués sont tenus à jour à chaque
+ * pose (seuls les bonus voisins des lignes modifiées sont recalculés) : la distance d’un siège
+ * à la capture d’un bonus (bonusDistance) se lit en O(1).
+ */
+class Position {
+public:
+    Position() = default;
+
+    /**
+     * @brief Photographie l’état d’une partie en cours.
+     * @param board Plateau.
+     * @param players Joueurs dans l’ordre de jeu (au plus kMaxPlayers).
+     * @param round Manche en cours (1..kMaxRounds).
+     * @param seat Siège dont c’est le tour.
+     * @return Position équivalente.
+     * @throws std::invalid_argument si le plateau dépasse kMaxSide ou s’il y a trop de joueurs.
+     */
+    static Position fromBoard(const Board& board, const std::vector<Player>& players, int round, int seat);
+
+    /** @brief Nombre de lignes. */
+    int rows() const { return rows_; }
+    /** @brief Nombre de colonnes. */
+    int cols() const { return cols_; }
+    /** @brief Nombre de sièges. */
+    int numSeats() const { return numSeats_; }
+    /** @brief Identifiant de Player du siège. */
+    int playerId(int seat) const { return playerIds_[seat]; }
+    /** @brief Siège d’un identifiant de Player, ou -1. */
+    int seatOf(int playerId) const;
+
+    /** @brief Manche en cours (au-delà de kMaxRounds : manches terminées). */
+    int round() const { return round_; }
+    /** @brief Siège dont c’est le tour. */
+    int toMove() const { return toMove_; }
+    /** @brief Indique si les kMaxRounds manches sont jouées. */
+    bool roundsOver() const { return round_ > kMaxRounds; }
+    /** @brief Passe au siège suivant (et à la manche suivante après le dernier siège). */
+    void endTurn();
+
+    /** @brief Cases vides ('.', bonus non capturés compris). */
+    const BitGrid& empty() const { return empty_; }
+    /** @brief Cases vides sans territoire voisin. */
+    const BitGrid& neutral() const { return neutral_; }
+    /** @brief Territoire d’un siège. */
+    const BitGrid& owned(int seat) const { return owned_[seat]; }
+    /** @brief Ancres d’un siège (cases vides voisines de son seul territoire). */
+    const BitGrid& anchors(int seat) const { return anchors_[seat]; }
+    /** @brief Indique si la case (x, y) est vide. */
+    bool isEmpty(int x, int y) const { return (empty_[y] >> x) & 1u; }
+
+    /** @brief Coupons d’échange d’un siège. */
+    int coupons(int seat) const { return coupons_[seat]; }
+    /** @brief Dépense un coupon (sans effet à 0). */
+    void useCoupon(int seat) { if (coupons_[seat] > 0) --coupons_[seat]; }
+    /** @brief Indique si le siège doit poser une pierre au début de son tour. */
+    bool rockPending(int seat) const { return rockPending_[seat]; }
+    /** @brief Lève l’obligation de poser une pierre. */
+    void clearRock(int seat) { rockPending_[seat] = false; }
+
+    /** @brief Nombre de cases bonus encore en jeu. */
+    int bonusCount() const { return bonusCount_; }
+    /** @brief Colonne du i-ème bonus. */
+    int bonusX(int i) const { return bonuses_[i].x; }
+    /** @brief Ligne du i-ème bonus. */
+    int bonusY(int i) const { return bonuses_[i].y; }
+    /** @brief Type du i-ème bonus. */
+    BonusKind bonusKind(int i) const { return bonuses_[i].kind; }
+    /** @brief Indique si la case (x, y) est un bonus encore en jeu (une telle case compte comme vide). */
+    bool isBonus(int x, int y) const {
+        for (int i = 0; i < bonusCount_; ++i)
+            if (bonuses_[i].x == x && bonuses_[i].y == y) return true;
+        return false;
+    }
+
+    /** @brief Côtés (voisines orthogonales) du i-ème bonus possédés par un siège (0..4). */
+    int bonusOwnedSides(int i, int seat) const { return bonusSides_[i][seat] & 0x0F; }
+
+    /**
+     * @brief Côtés du i-ème bonus qu’un siège ne pourra plus prendre : hors plateau, pierre,
+     *        case d’un autre siège ou case vide adjacente à un autre siège.
+     */
+    int bonusBlockedSides(int i, int seat) const { return bonusSides_[i][seat] >> 4; }
+
+    /**
+     * @brief Cases qu’il reste à un siège pour capturer le i-ème bonus.
+     * @return 0..4, ou -1 si un côté est bloqué (capture impossible).
+     */
+    int bonusDistance(int i, int seat) const {
+        return bonusBlockedSides(i, seat) > 0 ? -1 : 4 - bonusOwnedSides(i, seat);
+    }
+
+    /**
+     * @brief Masques de placement d’un siège (mêmes règles que MoveGenerator::masksFor).
+     */
+    PlacementMasks masks(int seat) const;
+
+    /**
+     * @brief Pose une tuile pour un siège, puis vérifie la capture de bonus.
+     *
+     * Le coup doit être légal (généré à partir de masks(seat)) : il n’est pas revérifié.
+     *
+     * @param seat Siège qui joue.
+     * @param o Orientation posée.
+     * @param x Colonne de l’origine.
+     * @param y Ligne de l’origine.
+     * @return Nombre de bonus capturés.
+     */
+    int place(int seat, const Orientation& o, int x, int y);
+
+    /**
+     * @brief Pose une case 1x1 pour un siège (phase finale), puis vérifie la capture de bonus.
+     * @return Nombre de bonus capturés.
+     */
+    int placeCell(int seat, int x, int y);
+
+    /**
+     * @brief Pose une pierre sur une case vide.
+     * @return false si la case n’est pas vide.
+     */
+    bool placeStone(int x, int y);
+
+    /** @brief Nombre de cases d’un siège. */
+    int cellCount(int seat) const;
+
+    /**
+     * @brief Côté du plus grand carré plein d’un siège.
+     *
+     * Érosions successives des masques (une ligne garde les origines des carrés k+1 dont
+     * elle et la suivante contiennent les deux colonnes) : O(lignes × côté).
+     */
+    int maxSquare(int seat) const;
+
+    /** @brief Score (plus grand carré, cases) d’un siège. */
+    SeatScore score(int seat) const { return { maxSquare(seat), cellCount(seat) }; }
+
+    /**
+     * @brief Récompense de fin de partie de chaque siège, dans [0, 1].
+     *
+     * Part des adversaires battus (plus grand carré puis cases, comme Game::printScores),
+     * une égalité comptant pour moitié.
+     *
+     * @param out Récompenses (numSeats() premières valeurs remplies).
+     */
+    void rewards(std::array<float, kMaxPlayers>& out) const;
+
+    /**
+     * @brief Récompenses (même règle) à partir de scores déjà calculés.
+     * @param scores Score de chaque siège.
+     * @param numSeats Nombre de sièges.
+     * @param out Récompenses (numSeats premières valeurs remplies).
+     */
+    static void rewards(const std::array<SeatScore, kMaxPlayers>& scores, int numSeats,
+                        std::array<float, kMaxPlayers>& out);
+
+private:
+    /**
+     * @struct BonusCell
+     * @brief Case bonus encore en jeu.
+     */
+    struct BonusCell {
+        std::uint8_t x = 0;
+        std::uint8_t y = 0;
+        BonusKind kind = BonusKind::Exchange;
+    };
+
+    std::int8_t rows_ = 0;
+    std::int8_t cols_ = 0;
+    std::int8_t numSeats_ = 0;
+    std::int8_t toMove_ = 0;
+    std::int8_t round_ = 1;
+    std::int8_t bonusCount_ = 0;
+    std::array<int, kMaxPlayers> playerIds_{};
+    std::array<std::uint8_t, kMaxPlayers> coupons_{};
+    std::array<bool, kMaxPlayers> rockPending_{};
+    std::array<BonusCell, kMaxBonuses> bonuses_{};
+    BitGrid empty_{};
+    BitGrid neutral_{};
+    std::array<BitGrid, kMaxPlayers> owned_{};
+    std::array<BitGrid, kMaxPlayers> anchors_{};
+    /// Par bonus et par siège : côtés possédés (bits 0-3) et bloqués (bits 4-7).
+    std::array<std::array<std::uint8_t, kMaxPlayers>, kMaxBonuses> bonusSides_{};
+
+    /**
+     * @brief Ajoute au siège les cases `cells` (lignes y0..y1) et met la frontière à jour.
+     *
+     * Les cases posées quittent toutes les frontières ; leur halo vide devient ancre du siège
+     * s’il était neutre et bloqué s’il était ancre d’un autre siège.
+     */
+    void claim_(int seat, const BitGrid& cells, int y0, int y1);
+
+    /**
+     * @brief Capture les bonus entourés par le siège et applique leurs effets.
+     * @return Nombre de bonus capturés.
+     */
+    int captureBonuses_(int seat);
+
+    /** @brief Recalcule les côtés du i-ème bonus pour tous les sièges. */
+    void refreshBonus_(int i);
+
+    /**
+     * @brief Recalcule les côtés des bonus voisins des cases changées : lignes y0..y1,
+     *        colonnes `columns` (bit x).
+     */
+    void refreshBonuses_(int y0, int y1, Row columns = ~Row(0));
+};
+
+#endif // POSITION_HPP_INCLUDED
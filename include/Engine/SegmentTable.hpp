@@ -0,0 +1,71 @@
+#ifndef SEGMENTTABLE_HPP_INCLUDED
+#define SEGMENTTABLE_HPP_INCLUDED
+
+#include <cstdint>
+#include <vector>
+#include "Engine/Shape.hpp"
+
+/**
+ * @class SegmentTable
+ * @brief Segments des orientations d’un catalogue rangés d’un seul bloc, pour la validation
+ *        rapide de Playout et BatchPlayout.
+ *
+ * Les segments sont ceux de Orientation::segments (découpés une fois par ShapeSet) ; la table
+ * les recopie à la suite, tuile par tuile et orientation par orientation, avec la hauteur et
+ * la plus longue suite de chaque tuile, pour que la boucle de validation d’un tour ne lise que
+ * quelques centaines d’octets contigus.
+ */
+class SegmentTable {
+public:
+    /**
+     * @struct Kernel
+     * @brief Orientation précompilée : segments `segments()[first, first + count)`.
+     */
+    struct Kernel {
+        std::uint16_t first;
+        std::uint8_t count;
+        std::uint8_t width;
+        std::uint8_t height;
+    };
+
+    /**
+     * @struct TileInfo
+     * @brief Orientations `kernels()[first, first + count)` d’une tuile, hauteur et suite maximales.
+     */
+    struct TileInfo {
+        std::uint16_t first = 0;
+        std::uint8_t count = 0;
+        std::uint8_t maxHeight = 0;
+        std::uint8_t maxLength = 0;
+    };
+
+    /** @brief Table vide (aucune tuile). */
+    SegmentTable() = default;
+
+    /** @brief Table d’un catalogue (même indice que InitTiles::all()). */
+    explicit SegmentTable(const std::vector<ShapeSet>& catalog);
+
+    /** @brief Recopie les segments d’un nouveau catalogue (capacité conservée). */
+    void setCatalog(const std::vector<ShapeSet>& catalog);
+
+    /** @brief Orientations d’une tuile. */
+    const TileInfo& tile(int tile) const { return tiles_[tile]; }
+
+    /** @brief Toutes les orientations (indexées par TileInfo::first). */
+    const Kernel* kernels() const { return kernels_.data(); }
+
+    /** @brief Tous les segments (indexés par Kernel::first). */
+    const Segment* segments() const { return segments_.data(); }
+
+    /** @brief Orientation i de la tuile (pour la pose). */
+    const Orientation& orientation(int tile, int i) const { return (*catalog_)[tile].orientations()[i]; }
+
+private:
+    std::vector<Segment> segments_;
+    std::vector<Kernel> kernels_;
+    std::vector<TileInfo> tiles_;
+    /// Catalogue source, référencé.
+    const std::vector<ShapeSet>* catalog_ = nullptr;
+};
+
+#endif // SEGMENTTABLE_HPP_INCLUDED
@@ -0,0 +1,111 @@
+#ifndef SHAPE_HPP_INCLUDED
+#define SHAPE_HPP_INCLUDED
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Engine/BitGrid.hpp"
+#include "Tile/Tile.hpp"
+
+/// Côté maximal de la boîte englobante d’une forme.
+constexpr int kMaxShapeSide = 8;
+
+/// Nombre maximal de cases d’une forme.
+constexpr int kMaxShapeCells = kMaxShapeSide * kMaxShapeSide;
+
+/**
+ * @struct Segment
+ * @brief Suite de cases contiguës d’une ligne de forme : cases (dx .. dx + length − 1, dy).
+ */
+struct Segment {
+    std::uint8_t dy = 0;
+    std::uint8_t dx = 0;
+    std::uint8_t length = 0;
+};
+
+/**
+ * @struct Orientation
+ * @brief Une orientation (rotation + miroir) précalculée d’une tuile, normalisée à l’origine.
+ *
+ * Les cases sont celles de `Tile::footprint(0, 0, rotations, flipped)` : un coup posé
+ * en (x, y) avec cette orientation occupe exactement `tile.footprint(x, y, rotations, flipped)`.
+ */
+struct Orientation {
+    /// Nombre de rotations de 90° (0..3), appliquées après le miroir.
+    std::uint8_t rotations = 0;
+    /// Miroir horizontal appliqué avant les rotations.
+    bool flipped = false;
+    /// Largeur de la boîte englobante.
+    std::uint8_t width = 0;
+    /// Hauteur de la boîte englobante.
+    std::uint8_t height = 0;
+    /// Nombre de cases.
+    std::uint8_t cellCount = 0;
+    /// Décalages (dx, dy) des cases, triés.
+    std::array<std::pair<std::uint8_t, std::uint8_t>, kMaxShapeCells> cells{};
+    /// Masque de chaque ligne de la forme (bit dx de la ligne dy).
+    std::array<Row, kMaxShapeSide> rows{};
+    /// Nombre de segments (presque toujours un par ligne).
+    std::uint8_t segmentCount = 0;
+    /// Suites de cases contiguës de chaque ligne, dans l’ordre des lignes puis des colonnes.
+    std::array<Segment, kMaxShapeCells> segments{};
+};
+
+/**
+ * @class ShapeSet
+ * @brief Ensemble des orientations distinctes d’une tuile (au plus 8).
+ *
+ * Les orientations symétriques (ex. carré, barre) ne sont conservées qu’une fois,
+ * ce qui évite de générer plusieurs fois le même placement.
+ */
+class ShapeSet {
+public:
+    ShapeSet() = default;
+
+    /**
+     * @brief Précalcule les orientations distinctes d’une tuile.
+     * @param tile Tuile source (sa forme courante sert de référence, rotation 0 sans miroir).
+     * @throws std::invalid_argument si la tuile est vide ou dépasse `kMaxShapeSide` de côté.
+     */
+    explicit ShapeSet(const Tile& tile);
+
+    /** @brief Identifiant de la tuile source. */
+    const std::string& tileId() const { return tileId_; }
+
+    /** @brief Orientations distinctes. */
+    const std::vector<Orientation>& orientations() const { return orientations_; }
+
+    /** @brief Nombre de cases de la forme. */
+    int cellCount() const { return orientations_.empty() ? 0 : orientations_.front().cellCount; }
+
+    /** @brief Longueur du plus long segment de toutes les orientations. */
+    int maxSegmentLength() const { return maxSegmentLength_; }
+
+    /**
+     * @brief Indice de l’orientation correspondant à (rotations, flipped).
+     * @param rotations Nombre de rotations (ramené à 0..3).
+     * @param flipped Miroir.
+     * @return Indice dans orientations(), ou -1 si la forme est vide.
+     */
+    int indexOf(int rotations, bool flipped) const;
+
+    /**
+     * @brief Indique si deux tuiles ont la même forme à rotation / miroir près.
+     * @param other Autre ensemble d’orientations.
+     * @return true si l’une des orientations de `other` coïncide avec la première de celui-ci.
+     */
+    bool sameShape(const ShapeSet& other) const;
+
+private:
+    /// Identifiant de la tuile source.
+    std::string tileId_;
+    /// Orientations distinctes, dans l’ordre (sans miroir r0..r3, puis miroir r0..r3).
+    std::vector<Orientation> orientations_;
+    /// Pour chaque (flipped * 4 + rotations), indice de l’orientation équivalente.
+    std::array<std::int8_t, 8> canonical_{};
+    /// Longueur du plus long segment.
+    int maxSegmentLength_ = 0;
+};
+
+#endif // SHAPE_HPP_INCLUDED
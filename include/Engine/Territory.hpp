@@ -0,0 +1,39 @@
+#ifndef TERRITORY_HPP_INCLUDED
+#define TERRITORY_HPP_INCLUDED
+
+#include <array>
+#include "Engine/BitGrid.hpp"
+#include "Engine/Position.hpp"
+
+/**
+ * @struct Territory
+ * @brief Potentiel territorial (Voronoï) : cases vides que chaque siège atteint avant les autres.
+ *
+ * Parcours en largeur multi-sources sur les masques de lignes : à chaque pas, le front de
+ * chaque siège est dilaté (décalages) et restreint aux cases qu’il peut prendre (libres pour
+ * lui : neutres ou ses ancres, comme PlacementMasks::free) et pas encore atteintes. Une case
+ * atteinte au même pas par un seul siège rejoint sa région ; par plusieurs, elle est disputée
+ * et n’est pas propagée. Tous les sièges avancent dans le même balayage : le coût est
+ * d’environ pas × sièges × lignes opérations sur des mots.
+ */
+struct Territory {
+    /// Cases vides atteintes strictement en premier par chaque siège.
+    std::array<BitGrid, kMaxPlayers> region{};
+    /// Cases vides atteintes au même pas par plusieurs sièges.
+    BitGrid contested{};
+    /// Nombre de cases de chaque région.
+    std::array<int, kMaxPlayers> area{};
+    /// Cases disputées atteintes par chaque siège.
+    std::array<int, kMaxPlayers> contestedArea{};
+    /// Nombre de pas du parcours (distance de la case atteinte la plus éloignée).
+    int steps = 0;
+
+    /**
+     * @brief Calcule le potentiel territorial de tous les sièges.
+     * @param position Position analysée.
+     * @return Régions, cases disputées et surfaces.
+     */
+    static Territory compute(const Position& position);
+};
+
+#endif // TERRITORY_HPP_INCLUDED
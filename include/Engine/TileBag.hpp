@@ -0,0 +1,159 @@
+#ifndef TILEBAG_HPP_INCLUDED
+#define TILEBAG_HPP_INCLUDED
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Tile/TileQueue.hpp"
+
+/// Taille maximale du catalogue gérée par la simulation.
+constexpr int kMaxCatalog = 256;
+
+/// Taille maximale de la partie connue de la pioche (fenêtre d’aperçu).
+constexpr int kMaxKnownTiles = 8;
+
+/**
+ * @class TileBag
+ * @brief Pioche vue par un joueur, pour la simulation : fenêtre connue + composition cachée.
+ *
+ * Seules les informations publiques sont utilisées : les tuiles de la fenêtre d’aperçu
+ * (dans l’ordre) et, pour la suite, le nombre d’exemplaires restants de chaque tuile du
+ * catalogue avant le prochain remélange (TileQueue::remainingOfShape). Au-delà de la fenêtre,
+ * les tirages sont échantillonnés selon ces compteurs et les poids du catalogue, comme le
+ * ferait le mode de tirage de la vraie pioche ; la composition complète est reconstituée
+ * à l’épuisement.
+ *
+ * Mode déterminisé (determinize()) : un ordre complet des tuiles cachées est échantillonné
+ * d’un coup, compatible avec la fenêtre et la composition, puis lu tuile par tuile. Les tirages
+ * coûtent alors O(1) au lieu d’un parcours du catalogue, et un nouvel appel rééchantillonne
+ * l’ordre des seules tuiles restantes (plusieurs échantillons à partir d’un même état).
+ *
+ * Les tuiles sont désignées par leur indice dans le catalogue (InitTiles::all()).
+ * Taille fixe (pas d’allocation à la copie) ; les poids sont partagés, pas copiés.
+ */
+class TileBag {
+public:
+    TileBag() = default;
+
+    /**
+     * @brief Construit la vue publique d’une pioche.
+     * @param queue Pioche réelle (seules la fenêtre et la composition sont lues).
+     * @param weights Poids du catalogue (doivent survivre au TileBag et à ses copies).
+     * @param window Nombre de tuiles visibles (5 dans le jeu).
+     * @throws std::length_error si le catalogue dépasse kMaxCatalog tuiles.
+     */
+    static TileBag fromQueue(const TileQueue& queue, const std::vector<double>& weights, int window = 5);
+
+    /** @brief Taille du catalogue. */
+    int catalogSize() const { return catalogSize_; }
+
+    /** @brief Nombre de tuiles encore connues (fenêtre non encore tirée). */
+    int knownCount() const { return knownCount_; }
+
+    /** @brief i-ème tuile connue (0 = prochaine tirée). */
+    int known(int i) const { return known_[knownHead_ + i]; }
+
+    /** @brief Exemplaires cachés restants d’une tuile avant remélange. */
+    int hiddenCount(int tile) const { return hidden_[tile]; }
+
+    /**
+     * @brief Échange la tuile en main avec la i-ème tuile connue (TileQueue::exchangeWithWindow).
+     * @param i Indice dans la fenêtre.
+     * @param current Tuile en main.
+     * @return Ancienne tuile de la fenêtre (nouvelle tuile en main).
+     */
+    int exchange(int i, int current);
+
+    /**
+     * @brief Tire la prochaine tuile (connue, sinon échantillonnée).
+     * @param rng Générateur uniforme (interface URBG).
+     * @return Indice de catalogue.
+     */
+    template <class URBG>
+    int draw(URBG& rng) {
+        if (knownCount_ > 0) {
+            --knownCount_;
+            return known_[knownHead_++];
+        }
+        if (determinized_) {
+            if (deckCount_ == 0) determinize(rng);
+            if (deckCount_ > 0) {
+                --deckCount_;
+                const int tile = deck_[deckHead_++];
+                --hidden_[tile];
+                return tile;
+            }
+        }
+        return sampleHidden_(uniform_(rng));
+    }
+
+    /**
+     * @brief Échantillonne l’ordre des tuiles cachées restantes (déterminisation).
+     *
+     * Mode Shuffle : permutation uniforme. Mode WeightedShuffle : ordre pondéré sans remise
+     * (même loi que les tirages successifs de la vraie pioche). Sans effet en mode
+     * WeightedWithReplacement, où les tirages sont indépendants. La pioche épuisée est
+     * reconstituée puis de nouveau échantillonnée.
+     *
+     * @param rng Générateur uniforme (interface URBG).
+     */
+    template <class URBG>
+    void determinize(URBG& rng) {
+        const int n = fillDeck_();
+        if (n < 0) return;
+        std::array<double, kMaxCatalog> u;
+        for (int i = 0; i < n; ++i) u[i] = uniform_(rng);
+        orderDeck_(u.data());
+        determinized_ = true;
+    }
+
+    /** @brief Vrai si l’ordre des tuiles cachées est fixé (determinize()). */
+    bool determinized() const { return determinized_; }
+
+private:
+    std::int16_t catalogSize_ = 0;
+    std::int8_t knownHead_ = 0;
+    std::int8_t knownCount_ = 0;
+    TileQueue::SamplingMode mode_ = TileQueue::SamplingMode::Shuffle;
+    std::array<std::uint8_t, kMaxKnownTiles> known_{};
+    /// Exemplaires restants hors fenêtre, par tuile.
+    std::array<std::uint16_t, kMaxCatalog> hidden_{};
+    /// Composition d’une pioche neuve (après remélange).
+    std::array<std::uint16_t, kMaxCatalog> full_{};
+    /// Poids effectifs (1 en mode Shuffle) partagés entre copies.
+    const std::vector<double>* weights_ = nullptr;
+    /// Ordre échantillonné des tuiles cachées, lu à partir de deckHead_.
+    std::array<std::uint8_t, kMaxCatalog> deck_{};
+    std::int16_t deckHead_ = 0;
+    std::int16_t deckCount_ = 0;
+    bool determinized_ = false;
+
+    /** @brief Réel uniforme dans [0, 1) à partir d’un URBG. */
+    template <class URBG>
+    static double uniform_(URBG& rng) {
+        return double(rng() - URBG::min()) / (double(URBG::max() - URBG::min()) + 1.0);
+    }
+
+    /** @brief Poids de tirage d’une tuile selon le mode. */
+    double weight_(int tile) const;
+
+    /**
+     * @brief Tire une tuile cachée proportionnellement à exemplaires × poids.
+     * @param u Réel uniforme dans [0, 1).
+     */
+    int sampleHidden_(double u);
+
+    /**
+     * @brief Range dans deck_ les tuiles cachées de poids non nul (composition complète si vide).
+     * @return Nombre de tuiles, ou -1 si l’ordre ne peut pas être fixé (tirages avec remise,
+     *         plus de kMaxCatalog tuiles).
+     */
+    int fillDeck_();
+
+    /**
+     * @brief Ordonne deck_[0, deckCount_) à partir d’autant de réels uniformes.
+     */
+    void orderDeck_(const double* u);
+};
+
+#endif // TILEBAG_HPP_INCLUDED
@@ -0,0 +1,81 @@
+#ifndef ZOBRIST_HPP_INCLUDED
+#define ZOBRIST_HPP_INCLUDED
+
+#include <array>
+#include <cstdint>
+#include "Engine/BitGrid.hpp"
+#include "Engine/Position.hpp"
+#include "Engine/TileBag.hpp"
+
+/**
+ * @class Zobrist
+ * @brief Clés de Zobrist (64 bits) pour identifier une position de jeu.
+ *
+ * La clé d’une position est le XOR des clés de ses éléments : chaque case possédée
+ * (siège, case), chaque pierre, le siège à jouer, la manche, les coupons et pierres
+ * en attente de chaque siège, et la tuile de chaque case de la fenêtre d’aperçu. Poser
+ * une tuile se répercute donc en quelques XOR (cell() pour chacune de ses cases) ; les
+ * éléments de tour (siège, manche, fenêtre) sont combinés à la demande par turnKey().
+ *
+ * Les clés sont tirées une fois (graine fixe) : une même position a la même clé d’une
+ * exécution à l’autre.
+ */
+class Zobrist {
+public:
+    /** @brief Tables partagées (construites au premier appel). */
+    static const Zobrist& instance();
+
+    /** @brief Clé d’une case (x, y) possédée par un siège. */
+    std::uint64_t cell(int seat, int x, int y) const { return cells_[seat][y * kMaxSide + x]; }
+
+    /** @brief Clé d’une pierre en (x, y). */
+    std::uint64_t stone(int x, int y) const { return stones_[y * kMaxSide + x]; }
+
+    /**
+     * @brief Clé de toutes les cases posées d’une position (territoires et pierres).
+     *
+     * Une pierre est une case ni vide ni possédée. Coût O(cases posées).
+     */
+    std::uint64_t board(const Position& pos) const;
+
+    /**
+     * @brief Clé de l’état de tour : siège à jouer, manche, tuile en main, coupons,
+     *        pierres en attente et fenêtre connue de la pioche.
+     * @param tile Tuile en main (-1 : aucune).
+     */
+    std::uint64_t turnKey(const Position& pos, const TileBag& bag, int tile) const {
+        return turnKey(pos, tile) ^ windowKey(bag);
+    }
+
+    /** @brief Clé de l’état de tour sans la fenêtre d’aperçu. */
+    std::uint64_t turnKey(const Position& pos, int tile) const;
+
+    /** @brief Clé de la fenêtre connue de la pioche (tuile de chaque case). */
+    std::uint64_t windowKey(const TileBag& bag) const;
+
+    /**
+     * @brief Clé du point de vue d’une recherche (siège racine d’une recherche paranoïaque) :
+     *        distingue les valeurs d’une même position évaluée pour des sièges différents.
+     */
+    std::uint64_t perspective(int seat) const { return perspective_[seat]; }
+
+    /** @brief Clé complète : board() ^ turnKey(). */
+    std::uint64_t hash(const Position& pos, const TileBag& bag, int tile) const {
+        return board(pos) ^ turnKey(pos, bag, tile);
+    }
+
+private:
+    Zobrist();
+
+    std::array<std::array<std::uint64_t, kMaxSide * kMaxSide>, kMaxPlayers> cells_{};
+    std::array<std::uint64_t, kMaxSide * kMaxSide> stones_{};
+    std::array<std::uint64_t, kMaxPlayers> toMove_{};
+    std::array<std::uint64_t, kMaxRounds + 2> round_{};
+    std::array<std::uint64_t, kMaxCatalog + 1> hand_{};
+    std::array<std::array<std::uint64_t, 4>, kMaxPlayers> coupons_{};
+    std::array<std::uint64_t, kMaxPlayers> rock_{};
+    std::array<std::array<std::uint64_t, kMaxCatalog>, kMaxKnownTiles> window_{};
+    std::array<std::uint64_t, kMaxPlayers> perspective_{};
+};
+
+#endif // ZOBRIST_HPP_INCLUDED
@@ -6,6 +6,14 @@
 #include "Player/Player.hpp"
 #include "Tile/InitTiles.hpp"
 #include "Tile/TileQueue.hpp"
+#include "Engine/Coverage.hpp"
+#include "Engine/Shape.hpp"
+#include "Engine/Position.hpp"
+#include "AI/Agent.hpp"
+#include "AI/OpeningBook.hpp"
+#include "AI/Ponderer.hpp"
+#include <map>
+#include <memory>
 #include <vector>
 #include <random>
 #include <string>
@@ -49,6 +57,28 @@ private:
     /// File de pioche des tuiles (deck + fenêtre d’aperçu).
     TileQueue queue;
 
+    /// Formes distinctes pouvant être piochées (poids > 0), triées par nombre de cases croissant.
+    std::vector<ShapeSet> drawableShapes;
+
+    /// Orientations de chaque tuile du catalogue (même indice que InitTiles::all()).
+    std::vector<ShapeSet> catalogShapes;
+
+    /// Cartes de couverture déjà affichées, par identifiant de tuile (mises à jour par
+    /// Coverage::update à chaque affichage).
+    mutable std::map<std::string, Coverage> tileCoverage;
+
+    /// Carte de couverture de toutes les formes piochables (même mise à jour).
+    mutable Coverage catalogCoverage{ std::vector<ShapeSet>{} };
+
+    /// Livre d’ouvertures de la phase de départ (fermé si le fichier est absent).
+    OpeningBook openingBook;
+
+    /// Joueurs ordinateur : identifiant du joueur → agent qui décide à sa place.
+    std::map<int, std::unique_ptr<Agent>> bots;
+
+    /// Analyse pendant la réflexion des joueurs humains (nullptr : désactivée).
+    std::unique_ptr<Ponderer> ponderer;
+
     /// Numéro de la manche en cours (1..maxRounds).
     int currentRound;
 
@@ -58,6 +88,9 @@ private:
     /// Indique si la partie est terminée.
     bool gameOver;
 
+    /// Mode d’aide : marque sur le plateau les origines légales de la tuile en main.
+    bool originHints;
+
 public:
 
     /**
@@ -128,15 +161,34 @@ public:
     */
     const Player& getPlayerById(int id) const;
 
+    /**
+    * @brief Indique si aucun joueur ne peut plus poser aucune des tuiles qu’il pourrait piocher.
+    *
+    * Le test part des ancres de chaque joueur (Board::getAnchors) et essaie les formes de la
+    * plus petite à la plus grande par masques de bits (MoveGenerator::hasAnyMove), en
+    * s’arrêtant au premier placement trouvé.
+    *
+    * @param board Plateau.
+    * @param players Joueurs.
+    * @param shapes Formes piochables, de préférence triées par taille croissante.
+    * @return true si le plateau est saturé ; false s’il reste un placement ou si aucune forme
+    *         n’est piochable.
+    */
+    static bool isSaturated(const Board& board, const std::vector<Player>& players,
+                            const std::vector<ShapeSet>& shapes);
+
 private:
 
     /**
     * @brief Configure les joueurs : nombre, noms, couleurs, ordre de jeu.
     *
     * Demande en entrée :
-    *  - nombre de joueurs (2 à 9) ;
-    *  - nom et couleur de chaque joueur parmi une liste disponible.
+    *  - nombre de joueurs (2 à 9), dont le nombre de joueurs ordinateur ;
+    *  - nom et couleur de chaque joueur humain parmi une liste disponible.
     *
+    * Les joueurs ordinateur reçoivent un nom ("Bot 1", …), la première couleur libre
+    * et un agent MctsAgent (un fil de recherche par cœur). S'il y a des joueurs humains,
+    * propose l'analyse en tâche de fond pendant leur réflexion (Ponderer).
     * Mélange ensuite l'ordre des joueurs aléatoirement.
     */
     void setupPlayers();
@@ -153,7 +205,9 @@ private:
     * @brief Charge les tuiles depuis le fichier JSON et initialise la pioche.
     *
     * Utilise InitTiles pour charger le catalogue depuis "Shapes.json",
-    * puis remplit TileQueue (avec mélange).
+    * puis remplit TileQueue (ordre pondéré par les poids du catalogue).
+    * Précalcule aussi les orientations du catalogue (catalogShapes) et
+    * les formes distinctes piochables (drawableShapes).
     */
     void setupTiles();
 
@@ -180,14 +234,78 @@ private:
     void playTurn(Player& player);
 
     /**
-    * @brief Fin de manche : évalue si la partie doit s’arrêter.
+    * @brief Tour d’un joueur ordinateur : pierre éventuelle, pioche, puis décision de l’agent
+    *        (échange, orientation, origine ou abandon), appliquée avec les mêmes règles
+    *        que pour un humain.
+    *
+    * @param player Joueur ordinateur dont c’est le tour.
     */
-    void endRound();
+    void playBotTurn(Player& player);
 
     /**
-    * @brief Indique si les conditions de fin de partie sont réunies.
+    * @brief Lance l’analyse en tâche de fond du tour d’un joueur humain (si activée).
+    *
+    * Le Ponderer classe les placements de la tuile en main et, si le joueur suivant
+    * est un ordinateur, prépare son tour pour les placements les plus probables.
+    *
+    * @param current Tuile en main.
+    */
+    void startPondering(const Tile& current);
+    /**
+    * @brief Affiche les meilleurs placements trouvés par l’analyse en tâche de fond.
+    */
+    void showHints() const;
+    /**
+    * @brief Affiche le plateau coloré par potentiel territorial (Territory) : chaque case
+    *        vide prend la couleur du joueur qui l’atteint le premier, '?' si plusieurs.
+    */
+    void showTerritory() const;
+    /**
+    * @brief Affiche la carte de couverture (Coverage) de la tuile en main pour le joueur
+    *        courant : chaque case vide indique combien de placements légaux la recouvrent
+    *        (chiffre 1..9 proportionnel au maximum), puis les cases que le joueur peut
+    *        atteindre avec une tuile quelconque et celles qu’aucun adversaire n’atteint.
     *
-    * Pour l’instant, toujours false (à étendre selon les règles).
+    * Les cartes sont conservées d’un affichage à l’autre et mises à jour de façon
+    * incrémentale (seules les lignes modifiées depuis le dernier affichage sont revues).
+    * @param current Tuile en main (toutes orientations).
+    */
+    void showCoverage(const Tile& current) const;
+    /**
+    * @brief Affiche le plateau en marquant ('o') chaque origine légale de la tuile en main
+    *        dans son orientation courante (MoveGenerator::legalOrigins sur les masques
+    *        tenus par le plateau, sans parcourir la grille).
+    * @param current Tuile en main.
+    */
+    void showOrigins(const Tile& current) const;
+    /**
+    * @brief Agent d’un joueur ordinateur.
+    * @param player Joueur.
+    * @return L’agent, ou nullptr pour un joueur humain.
+    */
+    Agent* botFor(const Player& player) const;
+
+    /**
+    * @brief Affiche les cases de départ conseillées par le livre d’ouvertures (vides, hors bonus).
+    * @param seat Indice (dans players) du joueur qui place sa case.
+    */
+    void showBookMoves(int seat) const;
+
+    /**
+    * @brief Photographie compacte de la partie pour les agents.
+    * @param seat Indice (dans players) du joueur dont c’est le tour.
+    * @return Position équivalente.
+    */
+    Position snapshot(int seat) const;
+
+    /**
+    * @brief Fin de manche : évalue si la partie doit s’arrêter (plateau saturé).
+    */
+    void endRound();
+
+    /**
+    * @brief Indique si les conditions de fin de partie sont réunies (isSaturated() sur
+    *        l’état de la partie).
     */
     bool isGameOver() const;
 
@@ -212,6 +330,14 @@ private:
     */
     bool promptExchange(Tile& current) ;
 
+    /**
+    * @brief Affiche le classement ExchangeAdvisor de la tuile courante et de la fenêtre
+    *        (placements légaux et meilleur gain de score de chaque tuile).
+    *
+    * @param current Tuile courante du joueur actif.
+    */
+    void showExchangeAdvice(const Tile& current) const;
+
 
     /**
     * @brief Dialogue avec le joueur pour placer la tuile courante sur le plateau.
@@ -323,6 +449,12 @@ private:
     */
     bool useRockBonus(Player& player);
 
+    /**
+    * @brief Affiche les 5 meilleures cases StoneAdvisor pour la pierre du joueur actif
+    *        (placements adverses retirés, extensions de carré bloquées).
+    */
+    void showStoneAdvice() const;
+
     /**
     * @brief Affiche le plateau via Display_Board.
     */
@@ -0,0 +1,70 @@
+#ifndef ALIASTABLE_HPP_INCLUDED
+#define ALIASTABLE_HPP_INCLUDED
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/**
+ * @class AliasTable
+ * @brief Table d’alias de Walker (variante de Vose) pour l’échantillonnage pondéré en O(1).
+ *
+ * Construite en O(n) à partir d’un vecteur de poids positifs ou nuls, la table permet
+ * ensuite de tirer un indice `i` avec une probabilité `w[i] / somme(w)` en temps constant :
+ * un tirage uniforme de colonne puis un tirage de Bernoulli entre la colonne et son alias.
+ *
+ * Remarques :
+ * - Les poids nuls ne sont jamais tirés.
+ * - La table est immuable après construction : pour retirer des éléments, il faut la reconstruire.
+ */
+class AliasTable {
+public:
+    /** @brief Construit une table vide (aucun tirage possible). */
+    AliasTable() = default;
+
+    /**
+     * @brief Construit immédiatement la table à partir de poids.
+     * @param weights Poids (>= 0) de chaque indice.
+     */
+    explicit AliasTable(const std::vector<double>& weights);
+
+    /**
+     * @brief (Re)construit la table à partir de poids.
+     * @param weights Poids (>= 0) de chaque indice ; les valeurs négatives sont traitées comme 0.
+     * @return true si au moins un poids est strictement positif, false sinon (table vide).
+     */
+    bool build(const std::vector<double>& weights);
+
+    /**
+     * @brief Tire un indice selon la distribution pondérée. O(1).
+     * @param g Générateur uniforme (ex. `std::mt19937`).
+     * @return Indice tiré, dans [0, size()).
+     * @pre !empty()
+     */
+    template <class URBG>
+    std::size_t sample(URBG& g) const {
+        std::uniform_int_distribution<std::size_t> column(0, prob_.size() - 1);
+        std::uniform_real_distribution<double> coin(0.0, 1.0);
+        std::size_t i = column(g);
+        return coin(g) < prob_[i] ? i : alias_[i];
+    }
+
+    /** @brief Nombre d’indices couverts par la table. */
+    std::size_t size() const { return prob_.size(); }
+
+    /** @brief Indique si la table ne permet aucun tirage. */
+    bool empty() const { return prob_.empty(); }
+
+    /** @brief Somme des poids utilisés lors de la construction. */
+    double totalWeight() const { return total_; }
+
+private:
+    /** @brief Probabilité de conserver la colonne plutôt que son alias. */
+    std::vector<double> prob_;
+    /** @brief Indice alias de chaque colonne. */
+    std::vector<std::uint32_t> alias_;
+    /** @brief Somme des poids. */
+    double total_ = 0.0;
+};
+
+#endif // ALIASTABLE_HPP_INCLUDED
@@ -13,6 +13,7 @@
  *
  * Cette classe permet de :
  * - Charger des tuiles à partir d’un fichier JSON ;
+ * - Associer à chaque tuile un poids de tirage (1 par défaut) ;
  * - Accéder à l’ensemble complet ou à une tuile spécifique par ID ;
  * - Supprimer les doublons basés sur la forme des tuiles.
  */
@@ -21,6 +22,9 @@ class InitTiles {
         /** @brief Conteneur des tuiles chargées depuis le fichier JSON. */
         std::vector<Tile> tiles_;
 
+        /** @brief Poids de tirage de chaque tuile (même indice que `tiles_`). */
+        std::vector<double> weights_;
+
     public:
         /** @brief Constructeur par défaut. */
         InitTiles() = default;
@@ -38,12 +42,15 @@ class InitTiles {
         * @code{.json}
         * {
         *   "tiles": [
-        *     { "id": "A", "cells": [[0,0], [1,0], [1,1]] },
+        *     { "id": "A", "cells": [[0,0], [1,0], [1,1]], "weight": 2.5 },
         *     { "id": "B", "cells": [[0,0], [0,1]] }
         *   ]
         * }
         * @endcode
         *
+        * Le champ `weight` est optionnel (1 par défaut) ; un poids négatif est ramené à 0,
+        * ce qui exclut la tuile des tirages pondérés.
+        *
         * @param jsonPath Chemin vers le fichier JSON à lire.
         * @return true si le chargement a réussi, false sinon.
         */
@@ -55,6 +62,12 @@ class InitTiles {
         */
         const std::vector<Tile>& all() const;
 
+        /**
+        * @brief Retourne les poids de tirage des tuiles.
+        * @return Référence constante vers le vecteur de poids, aligné sur all().
+        */
+        const std::vector<double>& weights() const;
+
         /**
         * @brief Recherche une tuile par identifiant.
         * @param id Identifiant de la tuile recherchée.
@@ -67,7 +80,8 @@ class InitTiles {
         * @brief Supprime les tuiles en double basées sur leur forme.
         *
         * Compare chaque tuile avec les autres via `Tile::shapeEquals()`
-        * et conserve uniquement une occurrence de chaque forme unique.
+        * et conserve uniquement une occurrence de chaque forme unique
+        * (avec le poids de cette première occurrence).
         */
         void deduplicateByShape();
 };
@@ -5,8 +5,10 @@
 #include <random>
 #include <vector>
 #include <iostream>
+#include <unordered_map>
 #include "Tile/Tile.hpp"
 #include "Tile/InitTiles.hpp"
+#include "Tile/AliasTable.hpp"
 
 /**
  * @class TileQueue
@@ -21,10 +23,36 @@
  * Remarques :
  * - La classe maintient deux structures : `all_` (toutes les tuiles) et `deck_` (ordre courant).
  * - Si `reshuffleOnExhaustion_` est vrai, la pioche se reconstitue automatiquement à vide.
+ * - Le mode de tirage (`SamplingMode`) choisit entre le mélange uniforme historique et un
+ *   tirage pondéré par les poids du catalogue, avec remise (table d’alias, O(1) par tirage) ou
+ *   sans remise (sommes cumulées, O(log n) par tirage : une table d’alias devrait être
+ *   reconstruite après chaque tuile retirée). Sans remise, les poids fixent l’ordre, pas la
+ *   fréquence : chaque tuile de poids > 0 sort une fois par cycle.
+ * - La composition de `deck_` (nombre de tuiles restantes par forme et par taille) est tenue
+ *   à jour à chaque tirage, échange et remélange : les requêtes associées sont en O(1).
  * - Non thread-safe.
  */
 class TileQueue {
 public:
+    /**
+     * @brief Manière dont l’ordre de la pioche est tiré à partir du catalogue.
+     */
+    enum class SamplingMode {
+        /// Chaque tuile une fois par cycle, ordre uniforme (poids ignorés).
+        Shuffle,
+        /// Chaque tuile de poids > 0 exactement une fois par cycle, les plus lourdes sortant
+        /// plus tôt (tirage successif pondéré sans remise, sommes cumulées en O(log n) par
+        /// tuile). Les poids ne changent que l’ordre : sur un cycle complet, toutes les tuiles
+        /// retenues sortent aussi souvent ; seul WeightedWithReplacement en fait des fréquences.
+        WeightedShuffle,
+        /// Tirages indépendants proportionnels aux poids (table d’alias, O(1) par tirage) ;
+        /// `deck_` ne contient qu’une fenêtre d’anticipation de `kLookahead` tuiles.
+        WeightedWithReplacement
+    };
+
+    /** @brief Taille de la fenêtre d’anticipation en mode avec remise (= fenêtre d’échange). */
+    static constexpr std::size_t kLookahead = 5;
+
     /**
     * @brief Construit une file de tuiles.
     * @param reshuffleOnExhaustion Si vrai, la pioche est reconstituée automatiquement à l’épuisement.
@@ -40,10 +68,27 @@ public:
      * @param src Source des tuiles (catalogue).
      * @param shuffle Si vrai, mélange l’ordre initial.
      * @param seed Graine RNG utilisée pour le mélange (par défaut, issue de `std::random_device`).
-     * @return true si l’initialisation a réussi, false si `src` est vide.
+     * @return true si l’initialisation a réussi, false si `src` est vide
+     *         (ou, en mode pondéré, si aucun poids n’est strictement positif).
      */
     bool initFrom(const InitTiles& src, bool shuffle = true, std::uint32_t seed = std::random_device{}());
 
+    /**
+     * @brief Choisit le mode de tirage ; à appeler avant initFrom().
+     * @param mode Mode de tirage.
+     */
+    void setSamplingMode(SamplingMode mode) { mode_ = mode; }
+
+    /**
+     * @brief Mode de tirage courant.
+     */
+    SamplingMode samplingMode() const { return mode_; }
+
+    /**
+     * @brief Poids de tirage du catalogue (alignés sur les indices de forme).
+     */
+    const std::vector<double>& weights() const { return weights_; }
+
     /**
      * @brief Prévisualise les prochaines tuiles sans les retirer.
      * @param count Nombre de tuiles à prévisualiser (tronqué si la pioche est plus petite).
@@ -101,6 +146,43 @@ public:
      */
     std::vector<std::string> nextTileIds(std::size_t count = 5) const;
 
+    /**
+     * @brief Nombre de formes distinctes du catalogue (taille de `all_`).
+     */
+    std::size_t shapeCount() const { return all_.size(); }
+
+    /**
+     * @brief Retrouve l’indice d’une forme du catalogue à partir de son identifiant.
+     * @param id Identifiant de la tuile.
+     * @return L’indice dans le catalogue, ou `std::nullopt` si l’ID est inconnu.
+     */
+    std::optional<std::size_t> shapeIndex(const std::string& id) const;
+
+    /**
+     * @brief Nombre d’exemplaires de la forme `shapeIndex` restant dans la pioche
+     *        avant le prochain remélange. O(1).
+     *
+     * En mode `WeightedWithReplacement`, porte uniquement sur la fenêtre d’anticipation.
+     * @param shapeIndex Indice de la forme dans le catalogue.
+     * @return Nombre de tuiles restantes (0 si l’indice est hors catalogue).
+     */
+    std::size_t remainingOfShape(std::size_t shapeIndex) const;
+
+    /**
+     * @brief Variante par identifiant de remainingOfShape().
+     * @param id Identifiant de la tuile.
+     * @return Nombre de tuiles restantes (0 si l’ID est inconnu).
+     */
+    std::size_t remainingOfShape(const std::string& id) const;
+
+    /**
+     * @brief Nombre de tuiles de `cellCount` cases restant dans la pioche
+     *        avant le prochain remélange. O(1).
+     * @param cellCount Taille des tuiles (nombre de cases).
+     * @return Nombre de tuiles restantes de cette taille.
+     */
+    std::size_t remainingOfSize(std::size_t cellCount) const;
+
 private:
     /** @brief Reconstituer/mélanger automatiquement la pioche lorsqu’elle est épuisée. */
     bool reshuffleOnExhaustion_;
@@ -110,12 +192,51 @@ private:
     std::deque<Tile> deck_;
     /** @brief Générateur pseudo-aléatoire pour les mélanges. */
     mutable std::mt19937 rng_;
+    /** @brief Mode de tirage. */
+    SamplingMode mode_ = SamplingMode::Shuffle;
+    /** @brief Poids de tirage de chaque tuile de `all_`. */
+    std::vector<double> weights_;
+    /** @brief Table d’alias sur `weights_` (tirages avec remise et ordre pondéré). */
+    AliasTable alias_;
+    /** @brief Indice dans `all_` de chaque identifiant de tuile. */
+    std::unordered_map<std::string, std::size_t> indexById_;
+    /** @brief Nombre de tuiles de chaque forme (indice de `all_`) présentes dans `deck_`. */
+    std::vector<std::size_t> shapeRemaining_;
+    /** @brief Nombre de tuiles de chaque taille (en cases) présentes dans `deck_`. */
+    std::vector<std::size_t> sizeRemaining_;
 
     /**
-     * @brief Reconstitue `deck_` à partir de `all_` et mélange.
+     * @brief Reconstitue `deck_` à partir de `all_` selon le mode de tirage.
      */
     void reshuffle_();
 
+    /**
+     * @brief Tire un ordre pondéré sans remise des tuiles de poids > 0.
+     *
+     * Chaque tirage descend un arbre de Fenwick des poids restants (sommes cumulées), puis
+     * retire le poids de la tuile tirée : O(log n) par tuile, quels que soient les poids.
+     *
+     * @return Indices dans `all_`, dans l’ordre de tirage.
+     */
+    std::vector<std::size_t> weightedOrder_();
+
+    /**
+     * @brief Complète la fenêtre d’anticipation par des tirages avec remise.
+     */
+    void refillWithReplacement_();
+
+    /**
+     * @brief Recalcule entièrement les compteurs de composition à partir de `deck_`.
+     */
+    void recount_();
+
+    /**
+     * @brief Met à jour les compteurs de composition pour une tuile ajoutée ou retirée de `deck_`.
+     * @param t Tuile concernée.
+     * @param delta +1 si la tuile entre dans la pioche, -1 si elle en sort.
+     */
+    void track_(const Tile& t, int delta);
+
     /**
      * @brief Construit une représentation ASCII d’une tuile.
      * @param t Tuile à représenter.
@@ -0,0 +1,103 @@
+/**
+* @file Agent.cpp
+ * @brief Implémentation des décisions par défaut d’Agent (départ, pierre, case finale)
+ *        et mesure du budget de temps des tours.
+ */
+
+#include "../../include/AI/Agent.hpp"
+#include "../../include/AI/FinalCellSolver.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+TurnDecision Agent::decideTurn(const TurnContext& ctx, const SearchLimits& limits) {
+    using Seconds = std::chrono::duration<double>;
+    const auto start = SearchLimits::Clock::now();
+    TurnDecision decision = search(ctx, limits);
+    const auto end = SearchLimits::Clock::now();
+
+    budget_.budget = limits.deadline == SearchLimits::Clock::time_point::max()
+                   ? 0.0 : std::max(0.0, Seconds(limits.deadline - start).count());
+    budget_.used = Seconds(end - start).count();
+    budget_.overrun = end > limits.deadline ? Seconds(end - limits.deadline).count() : 0.0;
+    budget_.cancelled = limits.token.cancelled();
+    return decision;
+}
+
+/**
+ * @brief Livre d’abord ; sinon score = 4 × distance (Manhattan) au territoire le plus proche
+ *        + distance au bord (≤ 4).
+ */
+std::pair<int,int> Agent::chooseStart(const Position& position, int seat) {
+    if (book_) {
+        std::array<BookMove, kBookMoves> moves;
+        const int n = book_->lookup(position, seat, moves);
+        for (int i = 0; i < n; ++i)
+            if (position.isEmpty(moves[i].x, moves[i].y) && !position.isBonus(moves[i].x, moves[i].y))
+                return { moves[i].x, moves[i].y };
+    }
+
+    const int rows = position.rows(), cols = position.cols();
+    std::vector<std::pair<int,int>> occupied;
+    for (int s = 0; s < position.numSeats(); ++s) {
+        if (s == seat) continue;
+        for (int y = 0; y < rows; ++y)
+            for (Row r = position.owned(s)[y]; r; r &= r - 1) occupied.emplace_back(lowestBit(r), y);
+    }
+
+    std::pair<int,int> best{-1, -1};
+    int bestScore = -1;
+    for (int y = 0; y < rows; ++y) {
+        for (int x = 0; x < cols; ++x) {
+            if (!position.isEmpty(x, y) || position.isBonus(x, y)) continue;
+            int far = rows + cols;
+            for (auto [ox, oy] : occupied) far = std::min(far, std::abs(ox - x) + std::abs(oy - y));
+            const int edge = std::min({x, y, cols - 1 - x, rows - 1 - y, 4});
+            const int score = 4 * far + edge;
+            if (score > bestScore) { bestScore = score; best = {x, y}; }
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief L’adversaire en tête est celui au meilleur score (plus grand carré, puis cases).
+ */
+std::optional<std::pair<int,int>> Agent::chooseStone(const Position& position, int seat) {
+    const int rows = position.rows();
+    int leader = -1;
+    SeatScore best{-1, -1};
+    for (int s = 0; s < position.numSeats(); ++s) {
+        if (s == seat || position.cellCount(s) == 0) continue;
+        const SeatScore sc = position.score(s);
+        if (sc.maxSquare > best.maxSquare || (sc.maxSquare == best.maxSquare && sc.cellCount > best.cellCount)) {
+            best = sc;
+            leader = s;
+        }
+    }
+    if (leader >= 0) {
+        const BitGrid& own = position.owned(leader);
+        std::optional<std::pair<int,int>> pick;
+        int bestTouch = -1;
+        for (int y = 0; y < rows; ++y) {
+            for (Row r = position.anchors(leader)[y]; r; r &= r - 1) {
+                const int x = lowestBit(r);
+                int touch = (x + 1 < position.cols() ? (own[y] >> (x + 1)) & 1u : 0u) + (x > 0 ? (own[y] >> (x - 1)) & 1u : 0u)
+                          + (y > 0 ? (own[y - 1] >> x) & 1u : 0u) + (y + 1 < rows ? (own[y + 1] >> x) & 1u : 0u);
+                if (touch > bestTouch) { bestTouch = touch; pick = std::make_pair(x, y); }
+            }
+        }
+        if (pick) return pick;
+    }
+    for (int y = 0; y < rows; ++y)
+        if (position.empty()[y]) return std::make_pair(lowestBit(position.empty()[y]), y);
+    return std::nullopt;
+}
+
+/**
+ * @brief Solveur exact (FinalCellSolver) : toutes les ancres sont évaluées sans rejouer la pose.
+ */
+std::optional<std::pair<int,int>> Agent::chooseFinalCell(const Position& position, int seat) {
+    const auto choice = FinalCellSolver::best(position, seat);
+    if (!choice) return std::nullopt;
+    return std::make_pair(choice->x, choice->y);
+}
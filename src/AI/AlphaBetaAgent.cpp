@@ -0,0 +1,299 @@
+/**
+* @file AlphaBetaAgent.cpp
+ * @brief Implémentation d’AlphaBetaAgent — alpha-bêta paranoïaque, approfondissement itératif,
+ *        table de transposition et ordre des coups.
+ */
+
+#include "../../include/AI/AlphaBetaAgent.hpp"
+#include "../../include/Engine/Territory.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+bool sameMove(const Move& a, const Move& b) {
+    return a.orientation == b.orientation && a.x == b.x && a.y == b.y;
+}
+
+/**
+ * @brief Nombre de cases d’un placement voisines (ou membres) de `near`.
+ */
+int contacts(const Orientation& o, const Move& m, const BitGrid& near) {
+    int n = 0;
+    for (int dy = 0; dy < o.height; ++dy) n += popCount((o.rows[dy] << m.x) & near[m.y + dy]);
+    return n;
+}
+
+} // namespace
+
+AlphaBetaAgent::AlphaBetaAgent() : AlphaBetaAgent(Config{}) {}
+
+AlphaBetaAgent::AlphaBetaAgent(Config config) : config_(config) {
+    std::size_t entries = 1;
+    while (entries < config_.tableEntries) entries <<= 1;
+    config_.tableEntries = entries;
+    table_.resize(config_.tableEntries);
+    if (config_.maxDepth < 1) config_.maxDepth = 1;
+    history_.assign(2 * 8 * kMaxSide * kMaxSide, 0);
+}
+
+AlphaBetaAgent::~AlphaBetaAgent() = default;
+
+/**
+ * @brief f(s) = Evaluation::score (critères pondérés par config_.weights ; les régions
+ *        Voronoï ne sont calculées que si leur poids est non nul) ;
+ *        valeur = f(siège) − max f(adversaires). En fin de partie, la part des adversaires
+ *        battus (Position::rewards) domine : ±kWin.
+ */
+int AlphaBetaAgent::evaluate(const Position& pos, int seat) const {
+    Territory territory;
+    if (config_.weights[EvalFeature::Territory] != 0) territory = Territory::compute(pos);
+    auto features = [&](int s) { return Evaluation::score(pos, s, config_.weights, &territory); };
+    int best = -kInfinity;
+    for (int s = 0; s < pos.numSeats(); ++s)
+        if (s != seat) best = std::max(best, features(s));
+    int value = features(seat) - (best == -kInfinity ? 0 : best);
+    if (pos.roundsOver()) {
+        std::array<float, kMaxPlayers> reward{};
+        pos.rewards(reward);
+        value += static_cast<int>((2.0f * reward[seat] - 1.0f) * kWin);
+    }
+    return value;
+}
+
+bool AlphaBetaAgent::outOfTime_() {
+    if (!aborted_ && (stats_.nodes & 63) == 0 && limits_->expired()) {
+        aborted_ = true;
+    }
+    return aborted_;
+}
+
+std::size_t AlphaBetaAgent::historyIndex_(bool maximizing, const Move& move) const {
+    return ((std::size_t(maximizing) * 8 + (move.orientation & 7)) * kMaxSide + move.y) * kMaxSide + move.x;
+}
+
+/**
+ * @brief Clés d’ordre : coup de la table, puis killers, puis historique et a priori
+ *        (contacts avec son territoire + taille, < 64).
+ */
+AlphaBetaAgent::Frame& AlphaBetaAgent::orderMoves_(const Position& pos, int tile, int ply, const Move* tableMove) {
+    while (static_cast<int>(frames_.size()) <= ply) {
+        frames_.push_back(std::make_unique<Frame>());
+        frames_.back()->order.reserve(MoveList::kCapacity);
+        killers_.emplace_back(Move{kPass, 0, 0}, Move{kPass, 0, 0});
+    }
+    Frame& f = *frames_[ply];
+    const int seat = pos.toMove();
+    const bool maximizing = seat == rootSeat_;
+    const ShapeSet& shape = (*catalog_)[tile];
+    MoveGenerator::generate(pos.masks(seat), shape, f.moves);
+
+    const BitGrid near = dilate(pos.owned(seat), pos.rows(), pos.cols());
+    const auto& [killer1, killer2] = killers_[ply];
+    f.order.clear();
+    for (std::size_t i = 0; i < f.moves.size(); ++i) {
+        const Move& m = f.moves[i];
+        int key;
+        if (tableMove && sameMove(m, *tableMove)) key = kInfinity;
+        else if (sameMove(m, killer1)) key = kInfinity - 1;
+        else if (sameMove(m, killer2)) key = kInfinity - 2;
+        else key = history_[historyIndex_(maximizing, m)] * 64
+                 + contacts(shape.orientations()[m.orientation], m, near) + shape.cellCount();
+        f.order.emplace_back(key, static_cast<std::uint16_t>(i));
+    }
+    std::sort(f.order.begin(), f.order.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+    return f;
+}
+
+/**
+ * @brief Les cases posées mettent à jour la clé par XOR ; une capture de bonus (rare, elle
+ *        peut changer un propriétaire) ou une pierre recalcule la clé.
+ */
+int AlphaBetaAgent::play_(const Position& pos, const TileBag& bag, int tile, std::uint8_t slot, const Move& move,
+                          std::uint64_t board, int depth, int ply, int alpha, int beta) {
+    ++stats_.nodes;
+    if (outOfTime_()) return 0;
+    const Zobrist& zobrist = Zobrist::instance();
+    Position next = pos;
+    TileBag nextBag = bag;
+    const int seat = pos.toMove();
+    int played = tile;
+    if (slot > 0) {
+        next.useCoupon(seat);
+        played = nextBag.exchange(slot - 1, tile);
+    }
+    if (move.orientation != kPass) {
+        const Orientation& o = (*catalog_)[played].orientations()[move.orientation];
+        if (next.place(seat, o, move.x, move.y) > 0) {
+            board = zobrist.board(next);
+        } else {
+            for (int dy = 0; dy < o.height; ++dy)
+                for (Row r = o.rows[dy] << move.x; r; r &= r - 1) board ^= zobrist.cell(seat, lowestBit(r), move.y + dy);
+        }
+    }
+    next.endTurn();
+    if (next.roundsOver()) return evaluate(next, rootSeat_);
+
+    const int toMove = next.toMove();
+    if (next.rockPending(toMove)) {
+        if (auto cell = chooseStone(next, toMove); cell && next.placeStone(cell->first, cell->second))
+            board ^= zobrist.stone(cell->first, cell->second);
+        next.clearRock(toMove);
+    }
+    if (depth <= 1 || nextBag.knownCount() == 0) {
+        if (depth <= 1) depthCut_ = true;
+        return evaluate(next, rootSeat_);
+    }
+    const int nextTile = nextBag.draw(rng_);
+    return search_(next, nextBag, nextTile, board, depth - 1, ply + 1, alpha, beta);
+}
+
+int AlphaBetaAgent::search_(const Position& pos, const TileBag& bag, int tile, std::uint64_t board,
+                            int depth, int ply, int alpha, int beta) {
+    // Scores paranoïaques du point de vue de rootSeat_ : la table, conservée d’une décision à
+    // l’autre, ne doit pas les servir à une recherche pour un autre siège.
+    const Zobrist& zobrist = Zobrist::instance();
+    const std::uint64_t key = board ^ zobrist.turnKey(pos, bag, tile) ^ zobrist.perspective(rootSeat_);
+    Entry& entry = table_[key & (table_.size() - 1)];
+    const Move* tableMove = nullptr;
+    if (entry.key == key && entry.bound != Bound::None) {
+        ++stats_.tableHits;
+        if (entry.depth >= depth) {
+            if (entry.bound == Bound::Exact) return entry.score;
+            if (entry.bound == Bound::Lower && entry.score >= beta) return entry.score;
+            if (entry.bound == Bound::Upper && entry.score <= alpha) return entry.score;
+        }
+        tableMove = &entry.move;
+    }
+
+    const bool maximizing = pos.toMove() == rootSeat_;
+    Frame& f = orderMoves_(pos, tile, ply, tableMove);
+    if (f.moves.empty()) {
+        const Move pass{kPass, 0, 0};
+        return play_(pos, bag, tile, 0, pass, board, depth, ply, alpha, beta);
+    }
+
+    const int alpha0 = alpha, beta0 = beta;
+    int best = maximizing ? -kInfinity : kInfinity;
+    Move bestMove = f.moves[f.order.front().second];
+    for (const auto& [orderKey, index] : f.order) {
+        const Move m = f.moves[index];
+        const int value = play_(pos, bag, tile, 0, m, board, depth, ply, alpha, beta);
+        if (aborted_) return 0;
+        if (maximizing ? value > best : value < best) {
+            best = value;
+            bestMove = m;
+        }
+        if (maximizing) alpha = std::max(alpha, best);
+        else beta = std::min(beta, best);
+        if (alpha >= beta) {
+            ++stats_.cutoffs;
+            auto& [killer1, killer2] = killers_[ply];
+            if (!sameMove(m, killer1)) {
+                killer2 = killer1;
+                killer1 = m;
+            }
+            history_[historyIndex_(maximizing, m)] += depth * depth;
+            break;
+        }
+    }
+
+    Entry& slot = table_[key & (table_.size() - 1)];
+    slot.key = key;
+    slot.score = best;
+    slot.move = bestMove;
+    slot.depth = static_cast<std::int8_t>(depth);
+    slot.bound = best <= alpha0 ? Bound::Upper : best >= beta0 ? Bound::Lower : Bound::Exact;
+    return best;
+}
+
+/**
+ * @brief Approfondissement itératif sur les coups de la racine (tuile en main, puis échanges).
+ *
+ * Une itération interrompue par les limites garde le premier coup (meilleur de l’itération
+ * précédente, ou meilleur a priori avant la première) et tout coup déjà prouvé meilleur
+ * que lui à la nouvelle profondeur.
+ */
+TurnDecision AlphaBetaAgent::search(const TurnContext& ctx, const SearchLimits& limits) {
+    start_ = Clock::now();
+    limits_ = &limits;
+    stats_ = Stats{};
+    aborted_ = false;
+    catalog_ = &ctx.catalog;
+    rootSeat_ = ctx.position.toMove();
+    for (int& h : history_) h /= 8;
+
+    const Position& pos = ctx.position;
+    const int seat = rootSeat_;
+    std::vector<RootMove> roots;
+    auto addMoves = [&](int tile, std::uint8_t slot) {
+        const Frame& f = orderMoves_(pos, tile, 0, nullptr);
+        for (const auto& [orderKey, index] : f.order) roots.push_back({slot, tile, f.moves[index], -kInfinity});
+    };
+    addMoves(ctx.tile, 0);
+    if (config_.exchanges && pos.coupons(seat) > 0) {
+        for (int k = 0; k < ctx.bag.knownCount(); ++k) addMoves(ctx.bag.known(k), static_cast<std::uint8_t>(k + 1));
+    }
+
+    TurnDecision d;
+    if (roots.empty()) {
+        d.tile = ctx.tile;
+        return d;
+    }
+
+    const std::uint64_t board = Zobrist::instance().board(pos);
+    RootMove best = roots.front();
+    std::size_t previousNodes = 0;
+    for (int depth = 1; depth <= config_.maxDepth; ++depth) {
+        const std::size_t before = stats_.nodes;
+        depthCut_ = false;
+        int alpha = -kInfinity;
+        RootMove iterationBest = roots.front();
+        std::size_t searched = 0;
+        for (RootMove& r : roots) {
+            // La tuile posée est celle de la racine : ce sont ses killers et son historique.
+            const int value = play_(pos, ctx.bag, ctx.tile, r.slot, r.move, board, depth, 0, alpha, kInfinity);
+            if (aborted_) break;
+            ++searched;
+            r.score = value;
+            if (value > alpha) {
+                alpha = value;
+                iterationBest = r;
+            }
+        }
+        if (aborted_) {
+            if (searched > 0) best = iterationBest;
+            break;
+        }
+        best = iterationBest;
+        stats_.depth = depth;
+        const std::size_t nodes = stats_.nodes - before;
+        stats_.branching = previousNodes > 0 ? double(nodes) / double(previousNodes) : 0.0;
+        previousNodes = nodes;
+        std::stable_sort(roots.begin(), roots.end(), [](const RootMove& a, const RootMove& b) { return a.score > b.score; });
+        if (!depthCut_) break;
+    }
+
+    d.exchangeSlot = best.slot > 0 ? best.slot - 1 : -1;
+    d.tile = best.tile;
+    d.pass = false;
+    d.move = best.move;
+
+    stats_.score = best.score;
+    stats_.seconds = std::chrono::duration<double>(Clock::now() - start_).count();
+    stats_.nodesPerSecond = stats_.seconds > 0.0 ? stats_.nodes / stats_.seconds : 0.0;
+    return d;
+}
+
+std::string AlphaBetaAgent::lastReport() const {
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(2)
+       << name() << " : depth " << stats_.depth << ", " << stats_.nodes << " nodes in " << stats_.seconds << " s ("
+       << std::setprecision(0) << stats_.nodesPerSecond << " nodes/s), branching factor "
+       << std::setprecision(2) << stats_.branching << ", " << stats_.tableHits << " table hits, "
+       << stats_.cutoffs << " cutoffs, score " << stats_.score;
+    return os.str();
+}
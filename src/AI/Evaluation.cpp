@@ -0,0 +1,96 @@
+/**
+* @file Evaluation.cpp
+ * @brief Implémentation de Evaluation — critères d’un siège et poids de l’évaluation.
+ */
+
+#include "../../include/AI/Evaluation.hpp"
+#include <fstream>
+#include <nlohmann/json.hpp>
+
+using nlohmann::json;
+
+namespace {
+
+const char* const kNames[kEvalFeatures] = {
+    "square", "cells", "anchors", "territory", "bonus", "mobility", "coupons"
+};
+
+int countCells(const BitGrid& mask, int rows) {
+    int n = 0;
+    for (int y = 0; y < rows; ++y)
+        if (mask[y]) n += popCount(mask[y]);
+    return n;
+}
+
+int bonusProgress(const Position& pos, int seat) {
+    int sides = 0;
+    for (int i = 0; i < pos.bonusCount(); ++i)
+        if (pos.bonusBlockedSides(i, seat) == 0) sides += pos.bonusOwnedSides(i, seat);
+    return sides;
+}
+
+/**
+ * @brief Cases libres pour le siège (neutres ou ses ancres) atteintes en deux pas depuis
+ *        ses ancres sans quitter ces cases.
+ */
+int mobility(const Position& pos, int seat) {
+    const int rows = pos.rows(), cols = pos.cols();
+    BitGrid free{};
+    for (int y = 0; y < rows; ++y) free[y] = pos.neutral()[y] | pos.anchors(seat)[y];
+    BitGrid reach = dilate(pos.anchors(seat), rows, cols);
+    for (int y = 0; y < rows; ++y) reach[y] &= free[y];
+    reach = dilate(reach, rows, cols);
+    for (int y = 0; y < rows; ++y) reach[y] &= free[y];
+    return countCells(reach, rows);
+}
+
+} // namespace
+
+const char* EvalWeights::name(int feature) {
+    return feature >= 0 && feature < kEvalFeatures ? kNames[feature] : "?";
+}
+
+bool EvalWeights::load(const std::string& path) {
+    std::ifstream f(path);
+    if (!f) return false;
+    const json j = json::parse(f, nullptr, false);
+    if (!j.is_object()) return false;
+    for (int i = 0; i < kEvalFeatures; ++i) {
+        const auto it = j.find(kNames[i]);
+        if (it != j.end() && it->is_number()) values[i] = static_cast<int>(it->get<double>());
+    }
+    return true;
+}
+
+bool EvalWeights::save(const std::string& path) const {
+    std::ofstream f(path);
+    if (!f) return false;
+    json j = json::object();
+    for (int i = 0; i < kEvalFeatures; ++i) j[kNames[i]] = values[i];
+    f << j.dump(2) << '\n';
+    return static_cast<bool>(f);
+}
+
+EvalVector Evaluation::features(const Position& position, int seat, const Territory& territory) {
+    EvalVector f{};
+    f[static_cast<int>(EvalFeature::Square)] = position.maxSquare(seat);
+    f[static_cast<int>(EvalFeature::Cells)] = position.cellCount(seat);
+    f[static_cast<int>(EvalFeature::Anchors)] = countCells(position.anchors(seat), position.rows());
+    f[static_cast<int>(EvalFeature::Territory)] = territory.area[seat];
+    f[static_cast<int>(EvalFeature::Bonus)] = bonusProgress(position, seat);
+    f[static_cast<int>(EvalFeature::Mobility)] = mobility(position, seat);
+    f[static_cast<int>(EvalFeature::Coupons)] = position.coupons(seat);
+    return f;
+}
+
+int Evaluation::score(const Position& position, int seat, const EvalWeights& weights, const Territory* territory) {
+    int value = 0;
+    if (const int w = weights[EvalFeature::Square]) value += w * position.maxSquare(seat);
+    if (const int w = weights[EvalFeature::Cells]) value += w * position.cellCount(seat);
+    if (const int w = weights[EvalFeature::Anchors]) value += w * countCells(position.anchors(seat), position.rows());
+    if (const int w = weights[EvalFeature::Territory]) value += w * territory->area[seat];
+    if (const int w = weights[EvalFeature::Bonus]) value += w * bonusProgress(position, seat);
+    if (const int w = weights[EvalFeature::Mobility]) value += w * mobility(position, seat);
+    if (const int w = weights[EvalFeature::Coupons]) value += w * position.coupons(seat);
+    return value;
+}
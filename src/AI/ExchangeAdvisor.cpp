@@ -0,0 +1,84 @@
+/**
+* @file ExchangeAdvisor.cpp
+ * @brief Implémentation d’ExchangeAdvisor — classement des échanges possibles.
+ */
+
+#include "../../include/AI/ExchangeAdvisor.hpp"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+ExchangeAdvisor::ExchangeAdvisor(int threads)
+    : threads_(threads > 0 ? threads : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()))) {}
+
+/**
+ * @brief Le plus grand carré ne peut grandir que si la pose ajoute des cases : le gain
+ *        de cases départage les poses de même carré.
+ */
+ExchangeAdvisor::Option ExchangeAdvisor::evaluateMoves_(const Position& position, int seat, const ShapeSet& shape,
+                                                        const MoveList& moves) {
+    Option option;
+    option.placements = static_cast<int>(moves.size());
+    if (moves.empty()) return option;
+
+    const SeatScore before = position.score(seat);
+    option.squareGain = -1;
+    for (const Move& m : moves) {
+        Position next = position;
+        const int bonuses = next.place(seat, shape.orientations()[m.orientation], m.x, m.y);
+        const SeatScore after = next.score(seat);
+        const int squareGain = after.maxSquare - before.maxSquare;
+        const int cellGain = after.cellCount - before.cellCount;
+        if (squareGain > option.squareGain || (squareGain == option.squareGain && cellGain > option.cellGain)) {
+            option.squareGain = squareGain;
+            option.cellGain = cellGain;
+            option.bonuses = bonuses;
+            option.best = m;
+        }
+    }
+    return option;
+}
+
+ExchangeAdvisor::Option ExchangeAdvisor::evaluate(const Position& position, int seat, const ShapeSet& shape) {
+    MoveList moves;
+    MoveGenerator::generate(position.masks(seat), shape, moves);
+    return evaluateMoves_(position, seat, shape, moves);
+}
+
+/**
+ * @brief Les fils se partagent les candidats par un compteur atomique ; chaque résultat
+ *        est écrit dans sa propre case, sans verrou.
+ */
+std::vector<ExchangeAdvisor::Option> ExchangeAdvisor::rank(const TurnContext& ctx) const {
+    const int seat = ctx.position.toMove();
+    std::vector<int> tiles{ctx.tile};
+    for (int i = 0; i < ctx.bag.knownCount(); ++i) tiles.push_back(ctx.bag.known(i));
+
+    BatchLegality batch;
+    for (int tile : tiles) batch.add(ctx.catalog[tile]);
+    batch.run(ctx.position.masks(seat));
+
+    std::vector<Option> options(tiles.size());
+    std::atomic<std::size_t> next{0};
+    auto run = [&] {
+        MoveList moves;
+        for (std::size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < tiles.size();) {
+            batch.moves(static_cast<int>(i), moves);
+            options[i] = evaluateMoves_(ctx.position, seat, ctx.catalog[tiles[i]], moves);
+            options[i].slot = static_cast<int>(i) - 1;
+            options[i].tile = tiles[i];
+        }
+    };
+    std::vector<std::thread> pool;
+    const int count = std::min(threads_, static_cast<int>(tiles.size()));
+    for (int t = 1; t < count; ++t) pool.emplace_back(run);
+    run();
+    for (auto& th : pool) th.join();
+
+    std::stable_sort(options.begin(), options.end(), [](const Option& a, const Option& b) {
+        if (a.squareGain != b.squareGain) return a.squareGain > b.squareGain;
+        if (a.cellGain != b.cellGain) return a.cellGain > b.cellGain;
+        return a.placements > b.placements;
+    });
+    return options;
+}
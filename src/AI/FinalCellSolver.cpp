@@ -0,0 +1,134 @@
+/**
+* @file FinalCellSolver.cpp
+ * @brief Implémentation de FinalCellSolver — phase finale 1x1 exacte.
+ */
+
+#include "../../include/AI/FinalCellSolver.hpp"
+#include <cstdlib>
+
+namespace {
+
+/**
+ * @brief Cases uniques manquantes des fenêtres de côté `side` d’un territoire.
+ *
+ * Calcul sur toutes les origines d’une ligne à la fois : pour chaque ligne, `full` marque
+ * les origines dont les `side` colonnes sont possédées et `one` celles où il en manque
+ * exactement une ; les mêmes règles, appliquées aux `side` lignes d’une fenêtre, donnent
+ * les fenêtres à une seule case manquante.
+ *
+ * @return false si aucune fenêtre n’est complétée par une case.
+ */
+bool completingCells(const BitGrid& own, int rows, int cols, int side, BitGrid& out) {
+    out = BitGrid{};
+    if (side > rows || side > cols) return false;
+    const Row origins = columnsMask(cols - side + 1);
+    BitGrid full{}, one{};
+    for (int y = 0; y < rows; ++y) {
+        Row f = origins, o = 0;
+        for (int i = 0; i < side; ++i) {
+            const Row b = own[y] >> i;
+            o = (o & b) | (f & ~b);
+            f &= b;
+        }
+        full[y] = f;
+        one[y] = o & origins;
+    }
+
+    const Row window = columnsMask(side);
+    bool found = false;
+    for (int y = 0; y + side <= rows; ++y) {
+        Row f = origins, o = 0;
+        for (int i = 0; i < side; ++i) {
+            o = (o & full[y + i]) | (f & one[y + i]);
+            f &= full[y + i];
+        }
+        for (; o; o &= o - 1) {
+            const int x = lowestBit(o);
+            int i = 0;
+            while (!((one[y + i] >> x) & 1u)) ++i;
+            out[y + i] |= ~own[y + i] & (window << x);
+            found = true;
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief Vrai si poser (x, y) complète l’entourage d’un bonus restant du siège.
+ */
+bool capturesBonus(const Position& position, int seat, int x, int y) {
+    const BitGrid& own = position.owned(seat);
+    auto owns = [&](int cx, int cy) { return (cx == x && cy == y) || ((own[cy] >> cx) & 1u); };
+    for (int i = 0; i < position.bonusCount(); ++i) {
+        const int bx = position.bonusX(i), by = position.bonusY(i);
+        if (std::abs(bx - x) + std::abs(by - y) != 1) continue;
+        if (bx > 0 && by > 0 && bx + 1 < position.cols() && by + 1 < position.rows()
+            && owns(bx - 1, by) && owns(bx + 1, by) && owns(bx, by - 1) && owns(bx, by + 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+std::vector<FinalCellSolver::Choice> FinalCellSolver::evaluate(const Position& position, int seat) {
+    std::vector<Choice> choices;
+    const SeatScore before = position.score(seat);
+    // levels[i] : cases qui complètent un carré de côté k+1+i.
+    std::vector<BitGrid> levels;
+    for (BitGrid g; completingCells(position.owned(seat), position.rows(), position.cols(),
+                                    before.maxSquare + 1 + static_cast<int>(levels.size()), g);) {
+        levels.push_back(g);
+    }
+    for (int y = 0; y < position.rows(); ++y) {
+        for (Row r = position.anchors(seat)[y]; r; r &= r - 1) {
+            const int x = lowestBit(r);
+            Choice c;
+            c.x = x;
+            c.y = y;
+            if (capturesBonus(position, seat, x, y)) {
+                Position next = position;
+                next.placeCell(seat, x, y);
+                const SeatScore after = next.score(seat);
+                c.maxSquare = after.maxSquare;
+                c.cellCount = after.cellCount;
+            } else {
+                c.maxSquare = before.maxSquare;
+                while (c.maxSquare - before.maxSquare < static_cast<int>(levels.size())
+                       && ((levels[c.maxSquare - before.maxSquare][y] >> x) & 1u)) {
+                    ++c.maxSquare;
+                }
+                c.cellCount = before.cellCount + 1;
+            }
+            c.squareGain = c.maxSquare - before.maxSquare;
+            c.cellGain = c.cellCount - before.cellCount;
+            choices.push_back(c);
+        }
+    }
+    return choices;
+}
+
+std::optional<FinalCellSolver::Choice> FinalCellSolver::best(const Position& position, int seat) {
+    std::optional<Choice> pick;
+    for (const Choice& c : evaluate(position, seat)) {
+        if (!pick || c.maxSquare > pick->maxSquare
+            || (c.maxSquare == pick->maxSquare && c.cellCount > pick->cellCount)) {
+            pick = c;
+        }
+    }
+    return pick;
+}
+
+std::array<std::optional<FinalCellSolver::Choice>, kMaxPlayers> FinalCellSolver::solve(const Position& position) {
+    std::array<std::optional<Choice>, kMaxPlayers> plan{};
+    Position pos = position;
+    for (int seat = 0; seat < pos.numSeats(); ++seat) {
+        if (pos.coupons(seat) <= 0) continue;
+        plan[seat] = best(pos, seat);
+        if (!plan[seat]) continue;
+        pos.useCoupon(seat);
+        pos.placeCell(seat, plan[seat]->x, plan[seat]->y);
+    }
+    return plan;
+}
@@ -0,0 +1,23 @@
+/**
+* @file HeuristicAgent.cpp
+ * @brief Implémentation de HeuristicAgent — joueur ordinateur à politique fixe.
+ */
+
+#include "../../include/AI/HeuristicAgent.hpp"
+
+HeuristicAgent::HeuristicAgent() : HeuristicAgent(Config{}) {}
+
+HeuristicAgent::HeuristicAgent(Config config)
+    : policy_(config.kind), rng_(config.seed ? config.seed : std::random_device{}()) {}
+
+/**
+ * @brief Un seul coup est évalué, sans consulter les limites : la décision est bien plus
+ *        courte que la granularité d’une échéance.
+ */
+TurnDecision HeuristicAgent::search(const TurnContext& ctx, const SearchLimits&) {
+    TurnDecision decision;
+    decision.tile = ctx.tile;
+    const int seat = ctx.position.toMove();
+    decision.pass = !policy_.choose(ctx.position, seat, ctx.catalog[ctx.tile], rng_, decision.move);
+    return decision;
+}
@@ -0,0 +1,356 @@
+/**
+* @file HeuristicPolicy.cpp
+ * @brief Implémentation de HeuristicPolicy — politiques de placement à un coup.
+ */
+
+#include "../../include/AI/HeuristicPolicy.hpp"
+#include <algorithm>
+#include <array>
+
+namespace {
+
+/**
+ * @brief Lignes de plateau balayées pour une forme : ancres entre les lignes lo et hi,
+ *        segments tabulés sur les lignes [r0, r1] qu’une forme touchant une ancre peut couvrir.
+ */
+struct Band {
+    int lo, hi, r0, r1;
+};
+
+/** @brief Bande des ancres du siège, false si le siège n’a aucune ancre. */
+bool anchorBand(const PlacementMasks& masks, const ShapeSet& shape, Band& band) {
+    band.lo = 0;
+    band.hi = masks.rows - 1;
+    while (band.lo < masks.rows && !masks.anchors[band.lo]) ++band.lo;
+    while (band.hi >= band.lo && !masks.anchors[band.hi]) --band.hi;
+    if (band.lo > band.hi) return false;
+    int maxHeight = 0;
+    for (const Orientation& o : shape.orientations()) maxHeight = std::max<int>(maxHeight, o.height);
+    band.r0 = std::max(0, band.lo - maxHeight + 1);
+    band.r1 = std::min(masks.rows - 1, band.hi + maxHeight - 1);
+    return true;
+}
+
+/**
+ * @struct SegmentMasks
+ * @brief Comme dans Playout : `fit[L][r]`, origines x où les cases x .. x + L − 1 de la
+ *        ligne r sont libres ; `hit[L][r]`, origines où l’une d’elles est une ancre. La
+ *        légalité d’une ligne d’origines coûte alors une opération par segment de la forme.
+ */
+struct SegmentMasks {
+    std::array<BitGrid, kMaxShapeSide + 1> fit, hit;
+
+    SegmentMasks(const PlacementMasks& masks, const ShapeSet& shape, const Band& band) {
+        for (int r = band.r0; r <= band.r1; ++r) {
+            fit[1][r] = masks.free[r];
+            hit[1][r] = masks.anchors[r];
+            for (int l = 2; l <= shape.maxSegmentLength(); ++l) {
+                fit[l][r] = fit[l - 1][r] & (masks.free[r] >> (l - 1));
+                hit[l][r] = hit[l - 1][r] | (masks.anchors[r] >> (l - 1));
+            }
+        }
+    }
+
+    /** @brief Origines légales de la ligne y (MoveGenerator::legalRow). */
+    Row legalRow(const Orientation& o, int y, Row xMask) const {
+        Row ok = xMask, touch = 0;
+        for (int i = 0; i < o.segmentCount; ++i) {
+            const Segment& seg = o.segments[i];
+            ok &= fit[seg.length][y + seg.dy] >> seg.dx;
+            touch |= hit[seg.length][y + seg.dy] >> seg.dx;
+        }
+        return ok & touch;
+    }
+};
+
+/**
+ * @brief Compteur en tranches de bits de W plans : plan k = bit k du compteur de chaque
+ *        origine de la ligne.
+ */
+template <int W>
+using Counter = std::array<Row, W>;
+
+/** @brief Ajoute `bits` (un par origine) au compteur : additionneur complet, sans branchement. */
+template <int W>
+inline void addBits(Counter<W>& c, Row bits) {
+    for (int k = 0; k < W; ++k) {
+        const Row carry = c[k] & bits;
+        c[k] ^= bits;
+        bits = carry;
+    }
+}
+
+/**
+ * @brief Restreint `cand` (non vide) aux origines où la forme couvre le plus de cases de
+ *        `mask`, et renvoie ce nombre (compteur lu plan par plan, du plus fort au plus faible).
+ */
+template <int W>
+int keepMostCovered(const Orientation& o, const BitGrid& mask, int y, Row& cand) {
+    Counter<W> c{};
+    for (int i = 0; i < o.cellCount; ++i) {
+        const auto [dx, dy] = o.cells[i];
+        addBits<W>(c, mask[y + dy] >> dx);
+    }
+    int v = 0;
+    for (int k = W - 1; k >= 0; --k) {
+        const Row t = cand & c[k];
+        cand = t ? t : cand;
+        v |= static_cast<int>(t != 0) << k;
+    }
+    return v;
+}
+
+/** @brief Entier uniforme dans [0, n) (multiplication et décalage, sans division). */
+inline unsigned below(std::mt19937& rng, unsigned n) {
+    return static_cast<unsigned>((std::uint64_t(rng()) * n) >> 32);
+}
+
+/** @brief Ligne d’origines retenue (orientation, ligne y, origines, score). */
+struct Line {
+    std::uint8_t orientation, y;
+    Row origins;
+    int score;
+};
+
+/**
+ * @brief Placement de score (principal, secondaire) maximal, scores sur W bits
+ *        (2^W > nombre de cases de la tuile). Voir HeuristicPolicy::chooseBest_.
+ */
+template <int W>
+bool bestPlacement(const PlacementMasks& masks, const ShapeSet& shape, const BitGrid& primary,
+                   const BitGrid& secondary, std::mt19937& rng, Move& out) {
+    Band band;
+    if (!anchorBand(masks, shape, band)) return false;
+    const SegmentMasks segments(masks, shape, band);
+    // `cover[L][r]` : origines où les L cases du segment sont toutes principales ;
+    // `primaryUpTo` : sommes préfixes des cases principales par ligne (borne d’une ligne).
+    std::array<BitGrid, kMaxShapeSide + 1> cover;
+    std::array<int, kMaxSide + 1> primaryUpTo{};
+    for (int r = band.r0; r <= band.r1; ++r) {
+        cover[1][r] = primary[r];
+        for (int l = 2; l <= shape.maxSegmentLength(); ++l)
+            cover[l][r] = cover[l - 1][r] & (primary[r] >> (l - 1));
+        primaryUpTo[r + 1] = primaryUpTo[r] + popCount(primary[r]);
+    }
+
+    // Premier passage : score principal ; seules les lignes au maximum courant sont gardées.
+    const auto& orients = shape.orientations();
+    const int cells = shape.cellCount();
+    std::array<Line, 8 * kMaxSide> lines;
+    int count = 0, bestPrimary = 0;
+    for (std::size_t oi = 0; oi < orients.size(); ++oi) {
+        const Orientation& o = orients[oi];
+        const int maxX = masks.cols - o.width;
+        const int maxY = std::min(masks.rows - o.height, band.hi);
+        if (maxX < 0) continue;
+        const Row xMask = columnsMask(maxX + 1);
+        for (int y = std::max(0, band.lo - o.height + 1); y <= maxY; ++y) {
+            if (primaryUpTo[y + o.height] - primaryUpTo[y] < bestPrimary) continue;
+            Row cand = segments.legalRow(o, y, xMask);
+            if (!cand) continue;
+
+            // Forme entièrement sur des cases principales : score maximal, sans compter.
+            Row full = cand;
+            for (int i = 0; i < o.segmentCount && full; ++i) {
+                const Segment& seg = o.segments[i];
+                full &= cover[seg.length][y + seg.dy] >> seg.dx;
+            }
+            int score = cells;
+            if (full) {
+                cand = full;
+            } else {
+                if (bestPrimary == cells) continue;
+                score = keepMostCovered<W>(o, primary, y, cand);
+                if (score < bestPrimary) continue;
+            }
+            if (score > bestPrimary) {
+                bestPrimary = score;
+                count = 0;
+            }
+            lines[count++] = { static_cast<std::uint8_t>(oi), static_cast<std::uint8_t>(y), cand, 0 };
+        }
+    }
+    if (count == 0) return false;
+
+    // Second passage : score secondaire des seules lignes ex æquo sur le principal, puis
+    // tirage de réservoir parmi les origines de score maximal.
+    int best = 0;
+    for (int i = 0; i < count; ++i) {
+        Line& line = lines[i];
+        line.score = keepMostCovered<W>(orients[line.orientation], secondary, line.y, line.origins);
+        best = std::max(best, line.score);
+    }
+    unsigned ties = 0;
+    for (int i = 0; i < count; ++i) {
+        const Line& line = lines[i];
+        if (line.score != best) continue;
+        const unsigned n = static_cast<unsigned>(popCount(line.origins));
+        ties += n;
+        if (below(rng, ties) < n) {
+            const int x = selectBit(line.origins, static_cast<int>(below(rng, n)));
+            out = { line.orientation, static_cast<std::uint8_t>(x), line.y };
+        }
+    }
+    return true;
+}
+
+/** @brief Origines x dont les bits x .. x + side − 1 sont tous à 1 (par doublements). */
+Row allOf(Row r, int side) {
+    int have = 1;
+    for (; have * 2 <= side; have *= 2) r &= r >> have;
+    return have < side ? r & (r >> (side - have)) : r;
+}
+
+/** @brief Origines x dont l’un des bits x .. x + side − 1 est à 1 (par doublements). */
+Row anyOf(Row r, int side) {
+    int have = 1;
+    for (; have * 2 <= side; have *= 2) r |= r >> have;
+    return have < side ? r | (r >> (side - have)) : r;
+}
+
+/**
+ * @brief Cases libres des fenêtres de côté `side` entièrement possédées ou libres et
+ *        contenant au moins une case possédée (seules les lignes proches du territoire
+ *        sont balayées).
+ */
+BitGrid growthCells(const BitGrid& own, const PlacementMasks& masks, int side) {
+    BitGrid out{};
+    if (side > masks.rows || side > masks.cols) return out;
+    int lo = 0, hi = masks.rows - 1;
+    while (lo < masks.rows && !own[lo]) ++lo;
+    while (hi >= lo && !own[hi]) --hi;
+    if (lo > hi) return out;
+    const int y0 = std::max(0, lo - side + 1), y1 = std::min(masks.rows - side, hi);
+
+    BitGrid all{}, any{};
+    for (int y = y0; y < y1 + side; ++y) {
+        all[y] = allOf(own[y] | masks.free[y], side);
+        any[y] = anyOf(own[y], side);
+    }
+    const Row origins = columnsMask(masks.cols - side + 1);
+    for (int y = y0; y <= y1; ++y) {
+        Row a = origins, o = 0;
+        for (int j = 0; j < side; ++j) {
+            a &= all[y + j];
+            o |= any[y + j];
+        }
+        const Row w = a & o;
+        if (!w) continue;
+        Row spread = 0;
+        for (int i = 0; i < side; ++i) spread |= w << i;
+        for (int j = 0; j < side; ++j) out[y + j] |= spread & masks.free[y + j];
+    }
+    return out;
+}
+
+} // namespace
+
+const char* HeuristicPolicy::name(Kind kind) {
+    switch (kind) {
+        case Kind::Random: return "Random";
+        case Kind::GreedySquare: return "Greedy square";
+        case Kind::BonusSeeker: return "Bonus seeker";
+        case Kind::Blocker: return "Blocker";
+    }
+    return "?";
+}
+
+bool HeuristicPolicy::choose(const Position& position, int seat, const ShapeSet& shape, std::mt19937& rng,
+                             Move& out) const {
+    if (kind_ == Kind::Random) return chooseRandom_(position, seat, shape, rng, out);
+
+    const PlacementMasks masks = position.masks(seat);
+    BitGrid primary{};
+    bool found = false;
+    if (kind_ == Kind::BonusSeeker) {
+        int nearest = 5;
+        for (int i = 0; i < position.bonusCount(); ++i) {
+            const int d = position.bonusDistance(i, seat);
+            if (d > 0) nearest = std::min(nearest, d);
+        }
+        for (int i = 0; i < position.bonusCount() && nearest < 5; ++i) {
+            if (position.bonusDistance(i, seat) != nearest) continue;
+            const int bx = position.bonusX(i), by = position.bonusY(i);
+            if (by > 0) primary[by - 1] |= Row(1) << bx;
+            if (by + 1 < masks.rows) primary[by + 1] |= Row(1) << bx;
+            if (bx > 0) primary[by] |= Row(1) << (bx - 1);
+            if (bx + 1 < masks.cols) primary[by] |= Row(1) << (bx + 1);
+        }
+        for (int y = 0; y < masks.rows; ++y) {
+            primary[y] &= masks.free[y];
+            found = found || primary[y];
+        }
+    } else if (kind_ == Kind::Blocker) {
+        BitGrid opponents{};
+        for (int s = 0; s < position.numSeats(); ++s) {
+            if (s == seat) continue;
+            for (int y = 0; y < masks.rows; ++y) opponents[y] |= position.anchors(s)[y];
+        }
+        primary = dilate(opponents, masks.rows, masks.cols);
+        for (int y = 0; y < masks.rows; ++y) primary[y] &= masks.free[y];
+        found = true;
+    }
+    if (!found) primary = growthCells(position.owned(seat), masks, position.maxSquare(seat) + 1);
+    return chooseBest_(masks, shape, primary, masks.anchors, rng, out);
+}
+
+/**
+ * @brief Les origines légales de chaque orientation sont calculées ligne par ligne, par
+ *        segments (SegmentMasks), sur les seules lignes qui peuvent toucher une ancre et
+ *        rangées dans un tableau de pile ; un placement y est tiré uniformément, sans
+ *        construire de liste de coups.
+ */
+bool HeuristicPolicy::chooseRandom_(const Position& position, int seat, const ShapeSet& shape,
+                                    std::mt19937& rng, Move& out) {
+    const PlacementMasks masks = position.masks(seat);
+    Band band;
+    if (!anchorBand(masks, shape, band)) return false;
+    const SegmentMasks segments(masks, shape, band);
+
+    const auto& orients = shape.orientations();
+    std::array<Line, 8 * kMaxSide> lines;
+    int count = 0, moves = 0;
+    for (std::size_t oi = 0; oi < orients.size(); ++oi) {
+        const Orientation& o = orients[oi];
+        const int maxX = masks.cols - o.width;
+        const int maxY = std::min(masks.rows - o.height, band.hi);
+        if (maxX < 0) continue;
+        const Row xMask = columnsMask(maxX + 1);
+        for (int y = std::max(0, band.lo - o.height + 1); y <= maxY; ++y) {
+            const Row legal = segments.legalRow(o, y, xMask);
+            if (!legal) continue;
+            lines[count++] = { static_cast<std::uint8_t>(oi), static_cast<std::uint8_t>(y), legal, 0 };
+            moves += popCount(legal);
+        }
+    }
+    if (moves == 0) return false;
+    int k = static_cast<int>(below(rng, static_cast<unsigned>(moves)));
+    for (int i = 0;; ++i) {
+        const int n = popCount(lines[i].origins);
+        if (k < n) {
+            out = { lines[i].orientation, static_cast<std::uint8_t>(selectBit(lines[i].origins, k)), lines[i].y };
+            return true;
+        }
+        k -= n;
+    }
+}
+
+/**
+ * @brief Deux passages sur les lignes d’origines légales (SegmentMasks) :
+ *        - score principal des 32 origines d’une ligne, accumulé case par case dans un
+ *          compteur en tranches de bits de la largeur juste nécessaire (2^W > nombre de
+ *          cases) ; seules les lignes qui atteignent le meilleur score principal courant
+ *          sont gardées. Les origines où la forme est entièrement principale (segments
+ *          `cover`) ont le score maximal sans compter, et une ligne dont les lignes de
+ *          plateau couvertes ont moins de cases principales que ce meilleur score est sautée ;
+ *        - score secondaire des seules lignes gardées, puis tirage de réservoir parmi les
+ *          origines de score maximal (chaque ex æquo a la même probabilité d’être choisi).
+ */
+bool HeuristicPolicy::chooseBest_(const PlacementMasks& masks, const ShapeSet& shape, const BitGrid& primary,
+                                  const BitGrid& secondary, std::mt19937& rng, Move& out) {
+    const int cells = shape.cellCount();
+    if (cells < 4) return bestPlacement<2>(masks, shape, primary, secondary, rng, out);
+    if (cells < 8) return bestPlacement<3>(masks, shape, primary, secondary, rng, out);
+    if (cells < 16) return bestPlacement<4>(masks, shape, primary, secondary, rng, out);
+    return bestPlacement<7>(masks, shape, primary, secondary, rng, out);
+}
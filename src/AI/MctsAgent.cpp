@@ -0,0 +1,411 @@
+/**
+* @file MctsAgent.cpp
+ * @brief Implémentation de MctsAgent — UCT max-n avec nœuds de hasard pour les tirages,
+ *        arbre partagé sans verrou ou arbres par fil.
+ */
+
+#include "../../include/AI/MctsAgent.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Case tirée uniformément parmi les bits d’un masque.
+ * @return false si le masque est vide.
+ */
+bool randomCell(const BitGrid& mask, int rows, std::mt19937& rng, int& x, int& y) {
+    int total = 0;
+    for (int r = 0; r < rows; ++r) total += popCount(mask[r]);
+    if (total == 0) return false;
+    int k = static_cast<int>(rng() % static_cast<unsigned>(total));
+    for (y = 0; y < rows; ++y) {
+        const int n = popCount(mask[y]);
+        if (k >= n) { k -= n; continue; }
+        Row r = mask[y];
+        while (k-- > 0) r &= r - 1;
+        x = lowestBit(r);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Nombre de cases d’un placement voisines (ou membres) de `near`.
+ */
+int contacts(const Orientation& o, const Move& m, const BitGrid& near) {
+    int n = 0;
+    for (int dy = 0; dy < o.height; ++dy) n += popCount((o.rows[dy] << m.x) & near[m.y + dy]);
+    return n;
+}
+
+/**
+ * @brief Addition atomique sur un flottant (boucle compare-and-swap).
+ */
+void atomicAdd(std::atomic<float>& target, float delta) {
+    float cur = target.load(std::memory_order_relaxed);
+    while (!target.compare_exchange_weak(cur, cur + delta, std::memory_order_relaxed)) {}
+}
+
+} // namespace
+
+MctsAgent::MctsAgent() : MctsAgent(Config{}) {}
+
+MctsAgent::MctsAgent(Config config) : config_(config) {
+    if (config_.threads < 1) config_.threads = 1;
+    const std::uint32_t seed = config_.seed ? config_.seed : std::random_device{}();
+    for (int t = 0; t < config_.threads; ++t) {
+        auto w = std::make_unique<Worker>();
+        w->rng.seed(seed + 0x9E3779B9u * static_cast<std::uint32_t>(t));
+        w->fast.seed(w->rng());
+        workers_.push_back(std::move(w));
+    }
+    const int treeCount = config_.parallelism == Parallelism::Root ? config_.threads : 1;
+    for (int t = 0; t < treeCount; ++t) {
+        auto tree = std::make_unique<Tree>();
+        // Au moins de quoi développer n’importe quelle racine (6 tuiles × 8 orientations × 32x32).
+        tree->capacity = std::max<std::size_t>(config_.maxEdges / treeCount, std::size_t(1) << 16);
+        // Réserves allouées ici plutôt qu’à la première décision : son budget n’inclut pas l’allocation.
+        tree->nodes.reset(new Node[tree->capacity]);
+        tree->edges.reset(new Edge[tree->capacity]);
+        tree->outcomes.reset(new Outcome[tree->capacity]);
+        trees_.push_back(std::move(tree));
+    }
+}
+
+MctsAgent::~MctsAgent() = default;
+
+/**
+ * @brief L’a priori d’un placement est son nombre de contacts avec le territoire du siège
+ *        (croissance compacte, favorable au plus grand carré), plus sa taille.
+ *
+ * Les candidats sont préparés dans les tampons du fil, puis copiés dans un bloc d’arêtes
+ * réservé par fetch_add : plusieurs fils peuvent développer en même temps.
+ */
+std::uint32_t MctsAgent::expand_(Tree& tree, Worker& w, const Position& pos, const TileBag& bag,
+                                 const std::vector<ShapeSet>& catalog, int tile, bool root) const {
+    const int seat = pos.toMove();
+    const PlacementMasks masks = pos.masks(seat);
+    const BitGrid near = dilate(pos.owned(seat), pos.rows(), pos.cols());
+
+    w.scratch.clear();
+    auto addMoves = [&](int t, std::uint8_t slot) {
+        const ShapeSet& shape = catalog[t];
+        MoveGenerator::generate(masks, shape, w.moves);
+        for (const Move& m : w.moves) {
+            const float prior = float(contacts(shape.orientations()[m.orientation], m, near) + shape.cellCount());
+            w.scratch.push_back({m, {slot, prior}});
+        }
+    };
+    addMoves(tile, 0);
+    if (root && pos.coupons(seat) > 0) {
+        for (int k = 0; k < bag.knownCount(); ++k) addMoves(bag.known(k), static_cast<std::uint8_t>(k + 1));
+    }
+    if (w.scratch.empty()) {
+        Move pass;
+        pass.orientation = kPass;
+        w.scratch.push_back({pass, {0, 0.0f}});
+    }
+
+    const std::size_t keep = root ? w.scratch.size()
+                                  : std::min<std::size_t>(w.scratch.size(), static_cast<std::size_t>(config_.maxChildren));
+    std::partial_sort(w.scratch.begin(), w.scratch.begin() + keep, w.scratch.end(),
+                      [](const auto& a, const auto& b) { return a.second.second > b.second.second; });
+
+    if (tree.edgeCount.load(std::memory_order_relaxed) + keep > tree.capacity) return kNone;
+    const std::size_t first = tree.edgeCount.fetch_add(keep, std::memory_order_relaxed);
+    const std::size_t ni = tree.nodeCount.fetch_add(1, std::memory_order_relaxed);
+    if (first + keep > tree.capacity || ni >= tree.capacity) return kNone;
+
+    for (std::size_t i = 0; i < keep; ++i) {
+        Edge& e = tree.edges[first + i];
+        e.move = w.scratch[i].first;
+        e.slot = w.scratch[i].second.first;
+        e.prior = w.scratch[i].second.second;
+        e.visits.store(0, std::memory_order_relaxed);
+        e.value.store(0.0f, std::memory_order_relaxed);
+        e.outcome.store(kNone, std::memory_order_relaxed);
+    }
+    Node& n = tree.nodes[ni];
+    n.firstEdge = static_cast<std::uint32_t>(first);
+    n.edgeCount = static_cast<std::uint32_t>(keep);
+    n.visits.store(0, std::memory_order_relaxed);
+    return static_cast<std::uint32_t>(ni);
+}
+
+/**
+ * @brief Seules les 2 + 1,5·√visites premières arêtes (par a priori) sont candidates ;
+ *        une arête jamais jouée est essayée avant toute autre.
+ *
+ * La visite est comptée immédiatement : tant que la récompense n’est pas remontée, l’arête
+ * paraît perdante aux autres fils (perte virtuelle).
+ */
+std::uint32_t MctsAgent::select_(Tree& tree, Node& node) const {
+    const std::uint32_t visits = node.visits.fetch_add(1, std::memory_order_relaxed);
+    const std::uint32_t open = std::min<std::uint32_t>(
+        node.edgeCount, 2 + static_cast<std::uint32_t>(1.5 * std::sqrt(double(visits))));
+    const double logN = std::log(double(visits) + 1.0);
+    std::uint32_t best = node.firstEdge;
+    double bestScore = -1.0;
+    for (std::uint32_t i = 0; i < open; ++i) {
+        Edge& e = tree.edges[node.firstEdge + i];
+        const std::uint32_t n = e.visits.load(std::memory_order_relaxed);
+        if (n == 0) {
+            best = node.firstEdge + i;
+            break;
+        }
+        const double score = e.value.load(std::memory_order_relaxed) / n + config_.exploration * std::sqrt(logN / n);
+        if (score > bestScore) {
+            bestScore = score;
+            best = node.firstEdge + i;
+        }
+    }
+    tree.edges[best].visits.fetch_add(1, std::memory_order_relaxed);
+    return best;
+}
+
+/**
+ * @brief La pierre d’un Rock bonus est posée sur une ancre adverse tirée au hasard.
+ */
+int MctsAgent::beginTurn_(Worker& w, Position& pos, TileBag& bag) {
+    const int seat = pos.toMove();
+    if (pos.rockPending(seat)) {
+        BitGrid targets{};
+        for (int s = 0; s < pos.numSeats(); ++s) {
+            if (s == seat) continue;
+            for (int y = 0; y < pos.rows(); ++y) targets[y] |= pos.anchors(s)[y];
+        }
+        int x, y;
+        if (randomCell(targets, pos.rows(), w.rng, x, y)) pos.placeStone(x, y);
+        pos.clearRock(seat);
+    }
+    return bag.draw(w.rng);
+}
+
+void MctsAgent::rollout_(Worker& w, Position& pos, TileBag& bag, const std::vector<ShapeSet>& catalog,
+                         int tile, std::array<float, kMaxPlayers>& reward) const {
+    if (config_.rollout == HeuristicPolicy::Kind::Random) {
+        Position::rewards(playout_.run(pos, bag, tile, w.fast), pos.numSeats(), reward);
+        return;
+    }
+    const HeuristicPolicy policy(config_.rollout);
+    while (tile >= 0) {
+        const int seat = pos.toMove();
+        const ShapeSet& shape = catalog[tile];
+        Move m;
+        if (policy.choose(pos, seat, shape, w.rng, m))
+            pos.place(seat, shape.orientations()[m.orientation], m.x, m.y);
+        pos.endTurn();
+        if (pos.roundsOver()) break;
+        tile = beginTurn_(w, pos, bag);
+    }
+    for (int seat = 0; seat < pos.numSeats(); ++seat) {
+        int x, y;
+        if (pos.coupons(seat) > 0 && randomCell(pos.anchors(seat), pos.rows(), w.rng, x, y)) {
+            pos.placeCell(seat, x, y);
+            pos.useCoupon(seat);
+        }
+    }
+    pos.rewards(reward);
+}
+
+/**
+ * @brief Un nouveau nœud est publié en insérant son tirage en tête de liste par
+ *        compare-and-swap ; si un autre fil a publié la même tuile entre-temps, son nœud
+ *        est utilisé et le nôtre abandonné (place perdue dans la réserve, sans conséquence).
+ */
+int MctsAgent::iterate_(Tree& tree, Worker& w, const TurnContext& ctx) const {
+    Position pos = ctx.position;
+    TileBag bag = ctx.bag;
+    if (config_.determinizations > 0) bag.determinize(w.rng);
+    w.path.clear();
+
+    std::uint32_t node = 0;
+    int tile = ctx.tile;
+    while (true) {
+        const std::uint32_t ei = select_(tree, tree.nodes[node]);
+        const int seat = pos.toMove();
+        w.path.emplace_back(ei, static_cast<std::uint8_t>(seat));
+
+        Edge& e = tree.edges[ei];
+        int played = tile;
+        if (e.slot > 0) {
+            pos.useCoupon(seat);
+            played = bag.exchange(e.slot - 1, tile);
+        }
+        if (e.move.orientation != kPass)
+            pos.place(seat, ctx.catalog[played].orientations()[e.move.orientation], e.move.x, e.move.y);
+        pos.endTurn();
+        if (pos.roundsOver()) {
+            tile = -1;
+            break;
+        }
+
+        tile = beginTurn_(w, pos, bag);
+        std::uint32_t head = e.outcome.load(std::memory_order_acquire);
+        std::uint32_t child = kNone;
+        for (std::uint32_t o = head; o != kNone; o = tree.outcomes[o].next) {
+            if (tree.outcomes[o].tile == tile) { child = tree.outcomes[o].node; break; }
+        }
+        if (child == kNone) {
+            const std::uint32_t created = expand_(tree, w, pos, bag, ctx.catalog, tile, false);
+            const std::size_t oi = created == kNone ? tree.capacity
+                                                    : tree.outcomeCount.fetch_add(1, std::memory_order_relaxed);
+            if (oi < tree.capacity) {
+                Outcome& out = tree.outcomes[oi];
+                out.tile = static_cast<std::uint16_t>(tile);
+                out.node = created;
+                out.next = head;
+                std::uint32_t seen = head;
+                while (!e.outcome.compare_exchange_weak(out.next, static_cast<std::uint32_t>(oi),
+                                                        std::memory_order_release, std::memory_order_acquire)) {
+                    bool published = false;
+                    for (std::uint32_t o = out.next; o != seen; o = tree.outcomes[o].next) {
+                        if (tree.outcomes[o].tile == tile) { published = true; break; }
+                    }
+                    if (published) break;
+                    seen = out.next;
+                }
+            }
+            break;
+        }
+        node = child;
+    }
+
+    // Feuille : une simulation par ordre de pioche, les suivantes sur un nouvel ordre des
+    // tuiles restantes (la tuile en main, déjà observée, est conservée).
+    const int samples = std::max(1, config_.determinizations);
+    std::array<float, kMaxPlayers> reward{};
+    auto simulate = [&](Position& sim, TileBag& simBag) {
+        std::array<float, kMaxPlayers> r{};
+        rollout_(w, sim, simBag, ctx.catalog, tile, r);
+        for (int s = 0; s < sim.numSeats(); ++s) reward[s] += r[s];
+    };
+    for (int k = 1; k < samples; ++k) {
+        Position sim = pos;
+        TileBag simBag = bag;
+        simBag.determinize(w.rng);
+        simulate(sim, simBag);
+    }
+    simulate(pos, bag);
+    for (auto [ei, seat] : w.path) atomicAdd(tree.edges[ei].value, reward[seat] / samples);
+    return static_cast<int>(w.path.size());
+}
+
+/**
+ * @brief Cherche jusqu’à `iterations` itérations ou l’expiration des limites sur `threads` fils,
+ *        puis joue l’arête la plus visitée de la racine (visites additionnées sur les arbres
+ *        en parallélisme racine).
+ *
+ * Les limites sont consultées avant chaque itération (une lecture d’horloge, négligeable
+ * devant une simulation) : le retard sur l’échéance est borné par la durée d’une itération.
+ * Sans itération, l’arête de meilleur a priori est jouée.
+ */
+TurnDecision MctsAgent::search(const TurnContext& ctx, const SearchLimits& limits) {
+    const auto t0 = Clock::now();
+    stats_ = Stats{};
+    stats_.threads = config_.threads;
+    playout_.setCatalog(ctx.catalog);
+
+    for (std::size_t t = 0; t < trees_.size(); ++t) {
+        Tree& tree = *trees_[t];
+        tree.nodeCount = 0;
+        tree.edgeCount = 0;
+        tree.outcomeCount = 0;
+        expand_(tree, *workers_[t], ctx.position, ctx.bag, ctx.catalog, ctx.tile, true);
+    }
+    for (auto& w : workers_) {
+        w->iterations = 0;
+        w->maxDepth = 0;
+    }
+
+    const Tree& first = *trees_.front();
+    if (first.nodes[0].edgeCount > 1) {
+        std::atomic<std::size_t> started{0};
+        std::atomic<bool> stop{false};
+        auto run = [&](int t) {
+            Worker& w = *workers_[t];
+            Tree& tree = *trees_[trees_.size() == 1 ? 0 : t];
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (limits.expired()) {
+                    stop.store(true, std::memory_order_relaxed);
+                    break;
+                }
+                if (started.fetch_add(1, std::memory_order_relaxed) >= config_.iterations) break;
+                w.maxDepth = std::max(w.maxDepth, iterate_(tree, w, ctx));
+                ++w.iterations;
+            }
+        };
+        std::vector<std::thread> pool;
+        for (int t = 1; t < config_.threads; ++t) pool.emplace_back(run, t);
+        run(0);
+        for (auto& th : pool) th.join();
+    }
+
+    const Node& root = first.nodes[0];
+    std::vector<std::pair<double, double>> total(root.edgeCount, {0.0, 0.0});
+    for (const auto& tree : trees_) {
+        const Node& r = tree->nodes[0];
+        for (std::uint32_t i = 0; i < r.edgeCount && i < root.edgeCount; ++i) {
+            total[i].first += tree->edges[r.firstEdge + i].visits.load();
+            total[i].second += tree->edges[r.firstEdge + i].value.load();
+        }
+        stats_.nodes += tree->nodeCount.load();
+        stats_.edges += std::min(tree->edgeCount.load(), tree->capacity);
+    }
+    std::uint32_t best = 0;
+    for (std::uint32_t i = 1; i < root.edgeCount; ++i) {
+        if (total[i].first > total[best].first) best = i;
+    }
+    const Edge& e = first.edges[root.firstEdge + best];
+
+    candidates_.clear();
+    for (std::uint32_t i = 0; i < root.edgeCount; ++i) {
+        const Edge& c = first.edges[root.firstEdge + i];
+        if (c.move.orientation == kPass) continue;
+        Candidate cand;
+        cand.exchangeSlot = c.slot > 0 ? c.slot - 1 : -1;
+        cand.tile = c.slot > 0 ? ctx.bag.known(c.slot - 1) : ctx.tile;
+        cand.move = c.move;
+        cand.visits = static_cast<std::uint32_t>(total[i].first);
+        cand.value = total[i].first > 0 ? total[i].second / total[i].first : 0.0;
+        candidates_.push_back(cand);
+    }
+    std::stable_sort(candidates_.begin(), candidates_.end(),
+                     [](const Candidate& a, const Candidate& b) { return a.visits > b.visits; });
+
+    TurnDecision d;
+    d.exchangeSlot = e.slot > 0 ? e.slot - 1 : -1;
+    d.tile = e.slot > 0 ? ctx.bag.known(e.slot - 1) : ctx.tile;
+    d.pass = e.move.orientation == kPass;
+    d.move = e.move;
+
+    for (const auto& w : workers_) {
+        stats_.iterations += w->iterations;
+        stats_.maxDepth = std::max(stats_.maxDepth, w->maxDepth);
+    }
+    stats_.playouts = stats_.iterations * static_cast<std::size_t>(std::max(1, config_.determinizations));
+    stats_.seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+    stats_.playoutsPerSecond = stats_.seconds > 0.0 ? stats_.playouts / stats_.seconds : 0.0;
+    stats_.value = total[best].first > 0 ? total[best].second / total[best].first : 0.0;
+    return d;
+}
+
+std::string MctsAgent::lastReport() const {
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(2)
+       << name() << " : " << stats_.playouts << " playouts in " << stats_.seconds << " s ("
+       << std::setprecision(0) << stats_.playoutsPerSecond << " playouts/s, "
+       << stats_.threads << (stats_.threads > 1 ? " threads" : " thread");
+    if (config_.determinizations > 1) os << ", " << config_.determinizations << " deck samples per iteration";
+    os << "), "
+       << stats_.nodes << " nodes, depth " << stats_.maxDepth
+       << ", expected result " << std::setprecision(2) << stats_.value;
+    return os.str();
+}
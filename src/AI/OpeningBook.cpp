@@ -0,0 +1,218 @@
+/**
+* @file OpeningBook.cpp
+ * @brief Implémentation de OpeningBook — livre d’ouvertures projeté en mémoire.
+ */
+
+#include "../../include/AI/OpeningBook.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+/**
+ * @struct BookHeader
+ * @brief En-tête du fichier (32 octets), suivi de `capacity` entrées.
+ */
+struct BookHeader {
+    char magic[8];
+    std::uint32_t version;
+    /// sizeof(BookEntry) à l’écriture : refuse un fichier d’une autre disposition.
+    std::uint32_t entrySize;
+    std::uint32_t capacity;
+    std::uint32_t count;
+    std::uint32_t reserved[2];
+};
+
+constexpr char kMagic[8] = { '2', 'C', 'C', 'B', 'O', 'O', 'K', '\0' };
+constexpr std::uint32_t kVersion = 1;
+
+static_assert(sizeof(BookHeader) == 32, "BookHeader: 32 octets attendus");
+static_assert(sizeof(BookEntry) == 32, "BookEntry: 32 octets attendus");
+
+/** @brief Finaliseur de SplitMix64. */
+std::uint64_t mix(std::uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+} // namespace
+
+OpeningBook::~OpeningBook() {
+    close();
+}
+
+bool OpeningBook::open(const std::string& path) {
+    close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size;
+    HANDLE mapping = nullptr;
+    if (GetFileSizeEx(file, &size) && size.QuadPart >= static_cast<LONGLONG>(sizeof(BookHeader)))
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) return false;
+    view_ = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view_) return false;
+    bytes_ = static_cast<std::size_t>(size.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(BookHeader))) {
+        ::close(fd);
+        return false;
+    }
+    void* view = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) return false;
+    view_ = view;
+    bytes_ = static_cast<std::size_t>(st.st_size);
+#endif
+
+    BookHeader header;
+    std::memcpy(&header, view_, sizeof header);
+    const bool valid = std::memcmp(header.magic, kMagic, sizeof kMagic) == 0
+        && header.version == kVersion && header.entrySize == sizeof(BookEntry)
+        && header.capacity > 0 && (header.capacity & (header.capacity - 1)) == 0
+        && header.count < header.capacity
+        && bytes_ >= sizeof(BookHeader) + std::size_t(header.capacity) * sizeof(BookEntry);
+    if (!valid) {
+        close();
+        return false;
+    }
+    entries_ = reinterpret_cast<const BookEntry*>(static_cast<const char*>(view_) + sizeof(BookHeader));
+    mask_ = header.capacity - 1;
+    count_ = header.count;
+    return true;
+}
+
+void OpeningBook::close() {
+    if (view_) {
+#ifdef _WIN32
+        UnmapViewOfFile(view_);
+#else
+        munmap(view_, bytes_);
+#endif
+    }
+    view_ = nullptr;
+    bytes_ = 0;
+    entries_ = nullptr;
+    mask_ = count_ = 0;
+}
+
+/**
+ * @brief Sondage linéaire depuis `hash & mask_` jusqu’à la clé ou un emplacement libre, au plus
+ *        `mask_ + 1` entrées (un fichier corrompu peut n’avoir aucun emplacement libre).
+ *        Le fichier n’étant pas analysé à l’ouverture, une entrée de plus de kBookMoves coups
+ *        est ignorée, ainsi que les coups hors du plateau (livre d’une autre version, fichier
+ *        abîmé).
+ */
+int OpeningBook::lookup(const Position& position, int seat, std::array<BookMove, kBookMoves>& out) const {
+    Key key;
+    if (!entries_ || !keyOf(position, seat, key)) return 0;
+    std::uint32_t i = static_cast<std::uint32_t>(key.hash) & mask_;
+    for (std::uint32_t probes = 0; probes <= mask_; ++probes, i = (i + 1) & mask_) {
+        const BookEntry& e = entries_[i];
+        if (e.key == 0) return 0;
+        if (e.key != key.hash) continue;
+        if (e.count > kBookMoves) return 0;
+        int n = 0;
+        for (int m = 0; m < e.count; ++m) {
+            int x = e.moves[m].x, y = e.moves[m].y;
+            if (x >= position.cols() || y >= position.rows()) continue;
+            transform(key.symmetry, true, position.rows(), x, y);
+            out[n++] = { static_cast<std::uint8_t>(x), static_cast<std::uint8_t>(y), e.moves[m].value };
+        }
+        return n;
+    }
+    return 0;
+}
+
+/**
+ * @brief Hachage de (côté, joueurs, siège) puis des cases de départ dans l’ordre des sièges,
+ *        pour chaque symétrie ; la clé est le plus petit.
+ */
+bool OpeningBook::keyOf(const Position& position, int seat, Key& key) {
+    const int rows = position.rows(), cols = position.cols();
+    std::array<int, kMaxPlayers> cx{}, cy{};
+    for (int s = 0; s < position.numSeats(); ++s) {
+        cx[s] = -1;
+        const int n = position.cellCount(s);
+        if (n > 1 || (n == 1 && s == seat)) return false;
+        for (int y = 0; y < rows && n == 1 && cx[s] < 0; ++y)
+            if (position.owned(s)[y]) { cx[s] = lowestBit(position.owned(s)[y]); cy[s] = y; }
+    }
+
+    const int symmetries = rows == cols ? 8 : 1;
+    key = Key{};
+    for (int k = 0; k < symmetries; ++k) {
+        std::uint64_t h = mix(0x2CC0000000000000ull ^ (std::uint64_t(rows) << 24) ^ (std::uint64_t(cols) << 16)
+                              ^ (std::uint64_t(position.numSeats()) << 8) ^ std::uint64_t(seat));
+        for (int s = 0; s < position.numSeats(); ++s) {
+            if (cx[s] < 0) continue;
+            int x = cx[s], y = cy[s];
+            transform(k, false, rows, x, y);
+            h = mix(h + ((std::uint64_t(s) << 16) | (std::uint64_t(x) << 8) | std::uint64_t(y)));
+        }
+        if (h == 0) h = 1;
+        if (k == 0 || h < key.hash) key = { h, k };
+    }
+    return true;
+}
+
+void OpeningBook::transform(int symmetry, bool inverse, int side, int& x, int& y) {
+    if (inverse && (symmetry == 5 || symmetry == 6)) symmetry = 11 - symmetry;
+    const int m = side - 1;
+    const int tx = x, ty = y;
+    switch (symmetry) {
+        case 1: x = m - tx; break;
+        case 2: y = m - ty; break;
+        case 3: x = m - tx; y = m - ty; break;
+        case 4: x = ty; y = tx; break;
+        case 5: x = m - ty; y = tx; break;
+        case 6: x = ty; y = m - tx; break;
+        case 7: x = m - ty; y = m - tx; break;
+        default: break;
+    }
+}
+
+bool OpeningBook::save(const std::string& path, const std::vector<BookEntry>& entries) {
+    std::uint32_t capacity = 16;
+    while (capacity < 2 * entries.size()) capacity *= 2;
+    std::vector<BookEntry> table(capacity);
+    for (const BookEntry& e : entries) {
+        std::uint32_t i = static_cast<std::uint32_t>(e.key) & (capacity - 1);
+        while (table[i].key != 0) i = (i + 1) & (capacity - 1);
+        table[i] = e;
+    }
+
+    BookHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof kMagic);
+    header.version = kVersion;
+    header.entrySize = sizeof(BookEntry);
+    header.capacity = capacity;
+    header.count = static_cast<std::uint32_t>(entries.size());
+
+    std::ofstream f(path, std::ios::binary);
+    if (!f) return false;
+    f.write(reinterpret_cast<const char*>(&header), sizeof header);
+    f.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(BookEntry)));
+    return static_cast<bool>(f);
+}
@@ -0,0 +1,128 @@
+/**
+* @file Ponderer.cpp
+ * @brief Implémentation de Ponderer — analyse pendant la réflexion d’un joueur humain.
+ */
+
+#include "../../include/AI/Ponderer.hpp"
+#include "../../include/Engine/Zobrist.hpp"
+#include <algorithm>
+#include <random>
+
+namespace {
+
+/**
+ * @brief Analyste : un fil, pas de limite d’itérations (seul le temps ou l’annulation arrête).
+ */
+MctsAgent::Config analystConfig() {
+    MctsAgent::Config config;
+    config.threads = 1;
+    config.iterations = static_cast<std::size_t>(-1);
+    return config;
+}
+
+} // namespace
+
+Ponderer::Ponderer() : Ponderer(Config{}) {}
+
+Ponderer::Ponderer(Config config) : config_(config), analyst_(analystConfig()) {}
+
+Ponderer::~Ponderer() {
+    stop();
+}
+
+void Ponderer::start(const TurnContext& ctx, Agent* nextBot) {
+    stop();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        hints_.clear();
+        hintPlayouts_ = 0;
+        anticipations_.clear();
+    }
+    token_ = CancellationToken{};
+    worker_ = std::thread(&Ponderer::run_, this, ctx.position, ctx.bag, &ctx.catalog, ctx.tile, nextBot, token_);
+}
+
+void Ponderer::stop() {
+    token_.cancel();
+    if (worker_.joinable()) worker_.join();
+}
+
+std::vector<MctsAgent::Candidate> Ponderer::hints(std::size_t count) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::vector<MctsAgent::Candidate>(hints_.begin(), hints_.begin() + std::min(count, hints_.size()));
+}
+
+/**
+ * @brief La fenêtre réelle compte une tuile de plus que l’anticipée (tirée entre-temps) :
+ *        seule la partie anticipée doit coïncider.
+ */
+std::optional<Ponderer::Prepared> Ponderer::take(const Position& position, const TileBag& bag, int tile) {
+    const Zobrist& zobrist = Zobrist::instance();
+    const std::uint64_t key = zobrist.board(position) ^ zobrist.turnKey(position, tile);
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const Anticipation& a : anticipations_) {
+        if (a.key != key || static_cast<int>(a.window.size()) > bag.knownCount()) continue;
+        bool same = true;
+        for (std::size_t i = 0; i < a.window.size() && same; ++i) same = bag.known(static_cast<int>(i)) == a.window[i];
+        if (!same) continue;
+        ++hits_;
+        return a.prepared;
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Une analyse interrompue ne remplace les conseils publiés que si elle a simulé
+ *        davantage de parties.
+ */
+void Ponderer::analyse_(const TurnContext& ctx, double seconds, const CancellationToken& token) {
+    analyst_.decideTurn(ctx, SearchLimits::within(seconds, token));
+    const std::size_t playouts = analyst_.lastStats().playouts;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (playouts <= hintPlayouts_) return;
+    hints_ = analyst_.lastCandidates();
+    hintPlayouts_ = playouts;
+}
+
+/**
+ * @brief Chaque anticipation rejoue un placement classé sur une copie de la position
+ *        (échange compris), puis tire la tuile du joueur suivant dans la fenêtre connue.
+ *        Un joueur suivant qui doit poser une pierre n’est pas anticipé (sa pierre change le plateau).
+ */
+void Ponderer::run_(Position position, TileBag bag, const std::vector<ShapeSet>* catalog, int tile, Agent* nextBot,
+                    CancellationToken token) {
+    const TurnContext ctx{position, bag, *catalog, tile};
+    analyse_(ctx, config_.hintSeconds, token);
+
+    if (nextBot) {
+        const Zobrist& zobrist = Zobrist::instance();
+        const std::vector<MctsAgent::Candidate> ranked = hints(static_cast<std::size_t>(std::max(0, config_.predictions)));
+        const int seat = position.toMove();
+        std::mt19937 rng(0);
+        for (const auto& c : ranked) {
+            if (token.cancelled()) break;
+            Position next = position;
+            TileBag nextBag = bag;
+            if (c.exchangeSlot >= 0) {
+                next.useCoupon(seat);
+                nextBag.exchange(c.exchangeSlot, tile);
+            }
+            next.place(seat, (*catalog)[c.tile].orientations()[c.move.orientation], c.move.x, c.move.y);
+            next.endTurn();
+            if (next.roundsOver() || next.rockPending(next.toMove()) || nextBag.knownCount() == 0) continue;
+            const int nextTile = nextBag.draw(rng);
+
+            const TurnDecision decision = nextBot->decideTurn({next, nextBag, *catalog, nextTile},
+                                                              SearchLimits::within(nextBot->defaultSeconds(), token));
+            if (token.cancelled()) break;
+            Anticipation a;
+            a.key = zobrist.board(next) ^ zobrist.turnKey(next, nextTile);
+            for (int i = 0; i < nextBag.knownCount(); ++i) a.window.push_back(nextBag.known(i));
+            a.prepared = {decision, nextBot->lastReport()};
+            std::lock_guard<std::mutex> lock(mutex_);
+            anticipations_.push_back(std::move(a));
+        }
+    }
+
+    if (!token.cancelled()) analyse_(ctx, config_.refineSeconds, token);
+}
@@ -0,0 +1,98 @@
+/**
+* @file StoneAdvisor.cpp
+ * @brief Implémentation de StoneAdvisor — classement des cases pour la pierre du Rock bonus.
+ */
+
+#include "../../include/AI/StoneAdvisor.hpp"
+#include <algorithm>
+
+StoneAdvisor::StoneAdvisor() : StoneAdvisor(Config{}) {}
+
+StoneAdvisor::StoneAdvisor(Config config) : config_(config) {}
+
+void StoneAdvisor::countCoverage(const PlacementMasks& masks, const std::vector<ShapeSet>& shapes,
+                                 MoveList& moves, CellCounts& counts) {
+    for (const ShapeSet& shape : shapes) {
+        MoveGenerator::generate(masks, shape, moves);
+        for (const Move& m : moves) {
+            const Orientation& o = shape.orientations()[m.orientation];
+            for (int dy = 0; dy < o.height; ++dy) {
+                int* row = &counts[(m.y + dy) * kMaxSide];
+                for (Row r = o.rows[dy] << m.x; r; r &= r - 1) ++row[lowestBit(r)];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Origines des carrés de côté k+1 par masques : pour chaque ligne, colonnes dont
+ *        les k+1 suivantes sont utilisables, puis intersection sur k+1 lignes consécutives.
+ */
+void StoneAdvisor::countGrowthSquares(const Position& position, int seat, CellCounts& counts) {
+    const int k = position.maxSquare(seat);
+    if (k == 0) return;
+    const int side = k + 1;
+    const int rows = position.rows(), cols = position.cols();
+    if (side > rows || side > cols) return;
+
+    const PlacementMasks masks = position.masks(seat);
+    const BitGrid& own = position.owned(seat);
+    BitGrid runs{};
+    for (int y = 0; y < rows; ++y) {
+        Row r = own[y] | masks.free[y];
+        for (int i = 1; i < side; ++i) r &= r >> 1;
+        runs[y] = r & columnsMask(cols - side + 1);
+    }
+    const Row window = columnsMask(side);
+    for (int y = 0; y + side <= rows; ++y) {
+        Row origins = runs[y];
+        for (int i = 1; i < side && origins; ++i) origins &= runs[y + i];
+        for (; origins; origins &= origins - 1) {
+            const int x = lowestBit(origins);
+            int empties = 0;
+            for (int i = 0; i < side; ++i) empties += popCount((masks.free[y + i] >> x) & window);
+            if (empties > 2 * k + 1) continue;
+            for (int i = 0; i < side; ++i) {
+                int* row = &counts[(y + i) * kMaxSide];
+                for (Row r = masks.free[y + i] & (window << x); r; r &= r - 1) ++row[lowestBit(r)];
+            }
+        }
+    }
+}
+
+std::vector<StoneAdvisor::Option> StoneAdvisor::rank(const Position& position, int seat,
+                                                     const std::vector<ShapeSet>& shapes, std::size_t count) const {
+    CellCounts opponents{}, own{}, squares{};
+
+    MoveList moves;
+    for (int s = 0; s < position.numSeats(); ++s) {
+        if (s == seat) {
+            countCoverage(position.masks(s), shapes, moves, own);
+        } else {
+            countCoverage(position.masks(s), shapes, moves, opponents);
+            countGrowthSquares(position, s, squares);
+        }
+    }
+
+    const double tiles = double(std::max<std::size_t>(1, shapes.size()));
+    std::vector<Option> options;
+    for (int y = 0; y < position.rows(); ++y) {
+        for (Row r = position.empty()[y]; r; r &= r - 1) {
+            const int x = lowestBit(r);
+            const int i = y * kMaxSide + x;
+            Option o;
+            o.x = x;
+            o.y = y;
+            o.opponentPlacements = opponents[i];
+            o.ownPlacements = own[i];
+            o.squaresBlocked = squares[i];
+            o.score = double(o.opponentPlacements - o.ownPlacements) / tiles + config_.squareWeight * o.squaresBlocked;
+            options.push_back(o);
+        }
+    }
+    const std::size_t keep = std::min(count, options.size());
+    std::partial_sort(options.begin(), options.begin() + keep, options.end(),
+                      [](const Option& a, const Option& b) { return a.score > b.score; });
+    options.resize(keep);
+    return options;
+}
@@ -7,6 +7,8 @@
 #include <cstdlib>
 #include <ctime>
 #include <cmath>
+#include <algorithm>
+#include <atomic>
 #include "../../include/Player/Player.hpp"
 #include "../../include/Bonus/Bonus.hpp"
 #include "../../include/Game/Game.hpp"
@@ -40,7 +42,10 @@ Board::Board(int numberOfPlayers) {
  *
  * Les cases sont initialisées à :
  * - '.' pour la grille d’affichage ;
- * - 0 dans ownerGrid (aucun propriétaire).
+ * - 0 dans ownerGrid (aucun propriétaire) ;
+ * - neutre pour la frontière (aucune ancre).
+ *
+ * L’historique des zones modifiées est réinitialisé (les caches doivent tout recalculer).
  *
  * @param numberOfPlayers Nombre de joueurs.
  */
@@ -58,6 +63,17 @@ void Board::initGrid(int numberOfPlayers) {
 
     grid = std::vector<std::vector<char>>(rows, std::vector<char>(cols, '.'));
     ownerGrid = std::vector<std::vector<int>>(rows, std::vector<int>(cols, 0));
+
+    neutral.fill(0);
+    for (int y = 0; y < rows; ++y) neutral[y] = columnsMask(cols);
+    anchors.clear();
+
+    // Chaque initialisation ouvre une plage de versions disjointe des précédentes :
+    // un cache calculé sur un autre plateau ne peut pas être pris pour à jour.
+    static std::atomic<std::uint64_t> epochs{ 0 };
+    version = (epochs.fetch_add(1, std::memory_order_relaxed) + 1) << 32;
+    dirtyFloor = version;
+    dirtyLog.clear();
 }
 
 /**
@@ -75,9 +91,30 @@ void Board::initGrid(int numberOfPlayers) {
  * @param numberOfPlayers Nombre de joueurs.
  */
 void Board::placeBonus(int numberOfPlayers) {
-    if (rows == 0 || cols == 0) return;
+    // Graine tirée une seule fois : deux plateaux créés dans la même seconde diffèrent.
+    static const bool seeded = (srand(static_cast<unsigned>(time(nullptr))), true);
+    (void)seeded;
+    placeBonusWith(numberOfPlayers, [](int n) { return rand() % n; });
+}
+
+/**
+ * @brief Place les bonus avec un générateur donné (reproductible).
+ *
+ * @param numberOfPlayers Nombre de joueurs.
+ * @param rng Générateur.
+ */
+void Board::placeBonus(int numberOfPlayers, std::mt19937& rng) {
+    placeBonusWith(numberOfPlayers, [&rng](int n) { return static_cast<int>(rng() % static_cast<unsigned>(n)); });
+}
 
-    srand(static_cast<unsigned>(time(nullptr)));
+/**
+ * @brief Tire les positions des bonus une à une, hors bords et hors voisinage d’un autre bonus.
+ *
+ * @param numberOfPlayers Nombre de joueurs.
+ * @param below Tirage uniforme dans [0, n).
+ */
+void Board::placeBonusWith(int numberOfPlayers, const std::function<int(int)>& below) {
+    if (rows == 0 || cols == 0) return;
 
     int nbExchange = std::ceil(1.5 * numberOfPlayers);
     int nbStone = std::ceil(0.5 * numberOfPlayers);
@@ -87,8 +124,8 @@ void Board::placeBonus(int numberOfPlayers) {
         int x, y;
         bool valid = false;
         while (!valid) {
-            x = rand() % (rows - 2) + 1;
-            y = rand() % (cols - 2) + 1;
+            x = below(rows - 2) + 1;
+            y = below(cols - 2) + 1;
             valid = (grid[x][y] == '.') && (bonuses.find({x,y}) == bonuses.end());
             if (valid) {
                 for (int dx = -1; dx <= 1; ++dx)
@@ -117,19 +154,20 @@ const std::map<std::pair<int,int>, std::shared_ptr<Bonus>>& Board::getBonus() co
 
 
 /**
- * @brief Place une pierre (obstacle) 1x1 sur le plateau.
+ * @brief Pose une case de territoire ('#') pour un joueur.
  *
- * La pierre est représentée par le caractère 'X' et n’appartient à aucun joueur
- * (ownerGrid = 0). Elle ne peut être placée que sur une case vide ('.').
+ * La case doit être vide ('.') et dans le plateau ; sinon rien n’est modifié.
+ * La frontière (ancres) est mise à jour autour de la case.
  *
  * @param x Coordonnée de colonne.
  * @param y Coordonnée de ligne.
- * @return true si la pierre a été placée, false sinon (hors limites ou case occupée).
+ * @param playerId Identifiant du joueur propriétaire.
  */
 void Board::placeTile(int x, int y, int playerId) {
     if (x >= 0 && x < cols && y >= 0 && y < rows && grid[y][x] == '.') {
         grid[y][x] = '#';
         ownerGrid[y][x] = playerId;
+        cellChanged(x, y);
     }
 }
 
@@ -149,9 +187,129 @@ bool Board::placeStone(int x, int y) {
 
     grid[y][x] = 'X';
     ownerGrid[y][x] = 0;
+    cellChanged(x, y);
     return true;
 }
 
+/**
+ * @brief Recalcule le statut de frontière d’une seule case.
+ *
+ * La case est d’abord retirée de `neutral` et des ancres de tous les joueurs, puis,
+ * si elle est vide, classée selon les propriétaires de ses 4 voisines.
+ *
+ * @param x Colonne.
+ * @param y Ligne.
+ */
+void Board::refreshCell(int x, int y) {
+    if (x < 0 || x >= cols || y < 0 || y >= rows || x >= kMaxSide || y >= kMaxSide) return;
+    const Row bit = Row(1) << x;
+    neutral[y] &= ~bit;
+    for (auto& [id, mask] : anchors) mask[y] &= ~bit;
+    if (grid[y][x] != '.') return;
+
+    static const int DX[4] = {1,-1,0,0};
+    static const int DY[4] = {0,0,1,-1};
+    int single = 0;
+    for (int k = 0; k < 4; ++k) {
+        int nx = x + DX[k], ny = y + DY[k];
+        if (nx < 0 || nx >= cols || ny < 0 || ny >= rows) continue;
+        int o = ownerGrid[ny][nx];
+        if (o == 0) continue;
+        if (single != 0 && o != single) return;
+        single = o;
+    }
+    if (single == 0) neutral[y] |= bit;
+    else anchors[single][y] |= bit;
+}
+
+/**
+ * @brief Propage la modification d’une case à la frontière (la case et ses 4 voisines)
+ *        et l’enregistre dans l’historique des zones modifiées.
+ * @param x Colonne.
+ * @param y Ligne.
+ */
+void Board::cellChanged(int x, int y) {
+    markDirty(x, y);
+    refreshCell(x, y);
+    refreshCell(x + 1, y);
+    refreshCell(x - 1, y);
+    refreshCell(x, y + 1);
+    refreshCell(x, y - 1);
+}
+
+/**
+ * @brief Ajoute la zone d’une case modifiée à l’historique, avec fusion si possible.
+ *
+ * La zone est la case élargie d’une case dans chaque direction (bornée au plateau).
+ * Si elle touche ou chevauche la dernière zone enregistrée, les deux sont fusionnées ;
+ * sinon une nouvelle entrée est ajoutée, la plus ancienne étant oubliée au-delà de
+ * `kDirtyLogSize` entrées.
+ *
+ * @param x Colonne.
+ * @param y Ligne.
+ */
+void Board::markDirty(int x, int y) {
+    ++version;
+    DirtyRect r{ std::max(0, x - 1), std::max(0, y - 1), std::min(cols - 1, x + 1), std::min(rows - 1, y + 1) };
+
+    if (!dirtyLog.empty()) {
+        DirtyRect& last = dirtyLog.back().second;
+        bool touches = r.x0 <= last.x1 + 1 && last.x0 <= r.x1 + 1
+                    && r.y0 <= last.y1 + 1 && last.y0 <= r.y1 + 1;
+        if (touches) {
+            last.x0 = std::min(last.x0, r.x0);
+            last.y0 = std::min(last.y0, r.y0);
+            last.x1 = std::max(last.x1, r.x1);
+            last.y1 = std::max(last.y1, r.y1);
+            dirtyLog.back().first = version;
+            return;
+        }
+    }
+    dirtyLog.emplace_back(version, r);
+    if (dirtyLog.size() > kDirtyLogSize) {
+        dirtyFloor = dirtyLog.front().first;
+        dirtyLog.pop_front();
+    }
+}
+
+/**
+ * @brief Zones modifiées après une version donnée.
+ * @param since Version de référence.
+ * @param out Zones modifiées (vidé au préalable).
+ * @return false si l’historique est incomplet depuis `since` (ou si `since` vient d’un autre plateau).
+ */
+bool Board::dirtySince(std::uint64_t since, std::vector<DirtyRect>& out) const {
+    out.clear();
+    if (since < dirtyFloor || since > version) return false;
+    for (auto it = dirtyLog.rbegin(); it != dirtyLog.rend() && it->first > since; ++it) {
+        out.push_back(it->second);
+    }
+    return true;
+}
+
+/**
+ * @brief Ancres d’un joueur.
+ * @param playerId Identifiant du joueur.
+ * @return Masque des ancres, ou un masque vide si le joueur n’a pas de territoire.
+ */
+const BitGrid& Board::getAnchors(int playerId) const {
+    static const BitGrid none{};
+    auto it = anchors.find(playerId);
+    return it == anchors.end() ? none : it->second;
+}
+
+/**
+ * @brief Nombre d’ancres d’un joueur.
+ * @param playerId Identifiant du joueur.
+ * @return Population du masque d’ancres.
+ */
+int Board::anchorCount(int playerId) const {
+    const BitGrid& a = getAnchors(playerId);
+    int n = 0;
+    for (int y = 0; y < rows && y < kMaxSide; ++y) n += popCount(a[y]);
+    return n;
+}
+
 /**
  * @brief Convertit une lettre de colonne (A, B, C, …) en index de colonne.
  *
@@ -173,7 +331,7 @@ int Board::letterToCol(const std::string& letter) {
  * au même joueur.
  *
  * Effets :
- * - La case bonus devient une case de territoire du joueur ('#') ;
+ * - La case bonus devient une case de territoire du joueur ('#'), frontière mise à jour ;
  * - Bonus 'E' : le joueur gagne un ticket d’échange ;
  * - Bonus 'R' : le joueur gagne un "Rock bonus" (possibilité de placer une pierre) ;
  * - Bonus 'S' : le joueur gagne un "Stealth bonus" (vol de tuile, à implémenter).
@@ -208,6 +366,7 @@ void Board::checkBonusCapture(int playerId, Game& game) {
         if (surrounded) {
             grid[by][bx]      = '#';
             ownerGrid[by][bx] = playerId;
+            cellChanged(bx, by);
 
             std::cout << "Bonus captured by player " << playerId
                       << " : " << bonusPtr->getName() << std::endl;
@@ -308,6 +467,7 @@ bool Board::placeFootprint(const std::vector<std::pair<int,int>>& pts, int playe
     for (auto [x,y] : pts) {
         grid[y][x] = '#';
         ownerGrid[y][x] = playerId;
+        cellChanged(x, y);
     }
     return true;
 }
\ No newline at end of file
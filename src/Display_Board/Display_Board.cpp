@@ -55,6 +55,14 @@ void Display_Board::printBottomBoarder(int cols) const {
  *  - coloriser les bonus capturés.
  */
 void Display_Board::display(const Game& game) const {
+    render(game, nullptr);
+}
+
+void Display_Board::display(const Game& game, const Overlay& overlay) const {
+    render(game, &overlay);
+}
+
+void Display_Board::render(const Game& game, const Overlay* overlay) const {
     const auto& grid = board.getGrid();
     const auto& ownerGrid = board.getOwnerGrid();
     const auto& bonuses = board.getBonus();
@@ -94,6 +102,17 @@ void Display_Board::display(const Game& game) const {
                 } else {
                     std::cout << it->second->getSymbol() << " ";
                 }
+            } else if (overlay && i < static_cast<int>(overlay->marks.size())
+                       && j < static_cast<int>(overlay->marks[i].size()) && overlay->marks[i][j] != '\0') {
+                int seat = -1;
+                if (i < static_cast<int>(overlay->seats.size()) && j < static_cast<int>(overlay->seats[i].size()))
+                    seat = overlay->seats[i][j];
+                if (seat >= 0 && seat < static_cast<int>(players.size())) {
+                    std::string ansi = game.getAnsiColor(players[seat].getColor());
+                    std::cout << ansi << overlay->marks[i][j] << "\033[0m ";
+                } else {
+                    std::cout << overlay->marks[i][j] << " ";
+                }
             } else if (cell == '#') {
                 if (owner > 0) {
                     const Player& p = game.getPlayerById(owner);
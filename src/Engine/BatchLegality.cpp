@@ -0,0 +1,123 @@
+/**
+* @file BatchLegality.cpp
+ * @brief Implémentation de BatchLegality — validation groupée des orientations d’un lot.
+ */
+
+#include "../../include/Engine/BatchLegality.hpp"
+#include <algorithm>
+
+namespace {
+
+bool sameOrientation(const Orientation& a, const Orientation& b) {
+    return a.width == b.width && a.height == b.height && a.rows == b.rows;
+}
+
+} // namespace
+
+void BatchLegality::clear() {
+    shapes_.clear();
+    kernelOf_.clear();
+    kernels_.clear();
+    patterns_.clear();
+    freeFit_.clear();
+    anchorHit_.clear();
+    maxHeight_ = 0;
+}
+
+int BatchLegality::add(const ShapeSet& shape) {
+    std::vector<int> ids;
+    for (const Orientation& o : shape.orientations()) {
+        auto it = std::find_if(kernels_.begin(), kernels_.end(),
+                               [&](const Kernel& k) { return sameOrientation(*k.orientation, o); });
+        if (it == kernels_.end()) {
+            Kernel k;
+            k.orientation = &o;
+            for (int dy = 0; dy < o.height; ++dy) {
+                auto p = std::find(patterns_.begin(), patterns_.end(), o.rows[dy]);
+                if (p == patterns_.end()) p = patterns_.insert(patterns_.end(), o.rows[dy]);
+                k.patterns.push_back(static_cast<std::uint16_t>(p - patterns_.begin()));
+            }
+            kernels_.push_back(std::move(k));
+            it = kernels_.end() - 1;
+            maxHeight_ = std::max<int>(maxHeight_, o.height);
+        }
+        ids.push_back(static_cast<int>(it - kernels_.begin()));
+    }
+    freeFit_.resize(patterns_.size());
+    anchorHit_.resize(patterns_.size());
+    shapes_.push_back(&shape);
+    kernelOf_.push_back(std::move(ids));
+    return static_cast<int>(shapes_.size()) - 1;
+}
+
+/**
+ * @brief Deux étapes :
+ *  - pour chaque motif de ligne distinct P (masque d’une ligne de forme), `freeFit[P][r]` =
+ *    ET des `free[r] >> dx` (dx ∈ P) et `anchorHit[P][r]` = OU des `anchors[r] >> dx` ;
+ *  - chaque orientation combine ensuite ses motifs, une opération par ligne de forme :
+ *    origines(y) = ET des freeFit[P_dy][y + dy] ∩ OU des anchorHit[P_dy][y + dy].
+ *  Seules les lignes dont une forme peut toucher une ancre sont calculées.
+ */
+void BatchLegality::run(const PlacementMasks& masks) {
+    for (Kernel& k : kernels_) k.origins = BitGrid{};
+    int lo = 0, hi = masks.rows - 1;
+    while (lo < masks.rows && !masks.anchors[lo]) ++lo;
+    while (hi >= lo && !masks.anchors[hi]) --hi;
+    if (lo > hi || kernels_.empty()) return;
+
+    const int r0 = std::max(0, lo - maxHeight_ + 1);
+    const int r1 = std::min(masks.rows - 1, hi + maxHeight_ - 1);
+    for (std::size_t p = 0; p < patterns_.size(); ++p) {
+        BitGrid& fit = freeFit_[p];
+        BitGrid& hit = anchorHit_[p];
+        for (int r = r0; r <= r1; ++r) {
+            Row f = ~Row(0), a = 0;
+            for (Row bits = patterns_[p]; bits; bits &= bits - 1) {
+                const int dx = lowestBit(bits);
+                f &= masks.free[r] >> dx;
+                a |= masks.anchors[r] >> dx;
+            }
+            fit[r] = f;
+            hit[r] = a;
+        }
+    }
+    for (Kernel& k : kernels_) {
+        const Orientation& o = *k.orientation;
+        const int maxY = std::min(masks.rows - o.height, hi);
+        if (o.width > masks.cols) continue;
+        const Row xMask = columnsMask(masks.cols - o.width + 1);
+        for (int y = std::max(0, lo - o.height + 1); y <= maxY; ++y) {
+            Row ok = xMask, touch = 0;
+            for (int dy = 0; dy < o.height && ok; ++dy) {
+                ok &= freeFit_[k.patterns[dy]][y + dy];
+                touch |= anchorHit_[k.patterns[dy]][y + dy];
+            }
+            k.origins[y] = ok & touch;
+        }
+    }
+}
+
+const BitGrid& BatchLegality::origins(int i, int orientation) const {
+    return kernels_[kernelOf_[i][orientation]].origins;
+}
+
+int BatchLegality::count(int i) const {
+    int n = 0;
+    for (int k : kernelOf_[i])
+        for (Row r : kernels_[k].origins)
+            if (r) n += popCount(r);
+    return n;
+}
+
+void BatchLegality::moves(int i, MoveList& out) const {
+    out.clear();
+    for (std::size_t oi = 0; oi < kernelOf_[i].size(); ++oi) {
+        const Kernel& k = kernels_[kernelOf_[i][oi]];
+        for (int y = 0; y < kMaxSide; ++y) {
+            for (Row r = k.origins[y]; r; r &= r - 1) {
+                out.push({ static_cast<std::uint8_t>(oi), static_cast<std::uint8_t>(lowestBit(r)),
+                           static_cast<std::uint8_t>(y) });
+            }
+        }
+    }
+}
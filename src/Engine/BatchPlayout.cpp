@@ -0,0 +1,297 @@
+/**
+* @file BatchPlayout.cpp
+ * @brief Implémentation de BatchPlayout — parties simulées par groupes, une partie par voie.
+ */
+
+#include "../../include/Engine/BatchPlayout.hpp"
+#include "../../include/Engine/Playout.hpp"
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define BATCH_AVX2 1
+#define BATCH_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#include <intrin.h>
+#define BATCH_AVX2 1
+#define BATCH_TARGET_AVX2
+#else
+#define BATCH_AVX2 0
+#endif
+
+namespace {
+
+/**
+ * @struct Lanes
+ * @brief Une ligne de plateau dans chacune des parties du groupe (un registre AVX2).
+ */
+struct alignas(32) Lanes {
+    Row v[kBatchLanes];
+};
+
+/**
+ * @struct LineSet
+ * @brief Lignes d’origines légales d’un tour : orientation et ligne communes, origines et
+ *        nombre cumulé de placements par partie.
+ */
+struct LineSet {
+    std::array<std::uint8_t, 8 * kMaxSide> orientation;
+    std::array<std::uint8_t, 8 * kMaxSide> y;
+    std::array<Lanes, 8 * kMaxSide> origins;
+    std::array<Lanes, 8 * kMaxSide> end;
+};
+
+/**
+ * @struct KernelInput
+ * @brief Données d’un tour pour le noyau de validation.
+ */
+struct KernelInput {
+    const Lanes* neutral;
+    const Lanes* anchors;
+    int rows, cols;
+    /// Lignes extrêmes où une partie du groupe a une ancre.
+    int lo, hi;
+    const SegmentTable::Kernel* kernels;
+    int kernelCount;
+    const Segment* segments;
+    int maxLength, maxHeight;
+};
+
+/**
+ * @brief Noyau scalaire : mêmes opérations que Playout::playRandom, répétées pour chaque voie.
+ * @return Nombre de lignes rangées dans `out`.
+ */
+int collectScalar(const KernelInput& in, LineSet& out) {
+    std::array<std::array<Lanes, kMaxSide>, kMaxShapeSide + 1> fit, hit;
+    const int r0 = std::max(0, in.lo - in.maxHeight + 1);
+    const int r1 = std::min(in.rows - 1, in.hi + in.maxHeight - 1);
+    for (int r = r0; r <= r1; ++r) {
+        for (int l = 0; l < kBatchLanes; ++l) {
+            const Row a = in.anchors[r].v[l], free = in.neutral[r].v[l] | a;
+            fit[1][r].v[l] = free;
+            hit[1][r].v[l] = a;
+            for (int len = 2; len <= in.maxLength; ++len) {
+                fit[len][r].v[l] = fit[len - 1][r].v[l] & (free >> (len - 1));
+                hit[len][r].v[l] = hit[len - 1][r].v[l] | (a >> (len - 1));
+            }
+        }
+    }
+
+    Lanes moves{};
+    int count = 0;
+    for (int i = 0; i < in.kernelCount; ++i) {
+        const SegmentTable::Kernel& k = in.kernels[i];
+        const int maxY = std::min(in.rows - k.height, in.hi);
+        if (k.width > in.cols) continue;
+        const Row xMask = columnsMask(in.cols - k.width + 1);
+        const Segment* seg = in.segments + k.first;
+        for (int y = std::max(0, in.lo - k.height + 1); y <= maxY; ++y) {
+            Row any = 0;
+            for (int l = 0; l < kBatchLanes; ++l) {
+                Row ok = xMask, touch = 0;
+                for (int s = 0; s < k.count; ++s) {
+                    ok &= fit[seg[s].length][y + seg[s].dy].v[l] >> seg[s].dx;
+                    touch |= hit[seg[s].length][y + seg[s].dy].v[l] >> seg[s].dx;
+                }
+                ok &= touch;
+                moves.v[l] += popCount(ok);
+                out.origins[count].v[l] = ok;
+                out.end[count].v[l] = moves.v[l];
+                any |= ok;
+            }
+            out.orientation[count] = static_cast<std::uint8_t>(i);
+            out.y[count] = static_cast<std::uint8_t>(y);
+            count += any != 0;
+        }
+    }
+    return count;
+}
+
+#if BATCH_AVX2
+
+/** @brief Population de chaque mot de 32 bits (table de 16 quartets, vpshufb). */
+BATCH_TARGET_AVX2 inline __m256i popCount8(__m256i v) {
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(table, _mm256_and_si256(v, nibble)),
+                                          _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi32(v, 4), nibble)));
+    return _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, _mm256_set1_epi8(1)), _mm256_set1_epi16(1));
+}
+
+/**
+ * @brief Noyau AVX2 : chaque opération sur une ligne traite les kBatchLanes parties.
+ * @return Nombre de lignes rangées dans `out`.
+ */
+BATCH_TARGET_AVX2 int collectAvx2(const KernelInput& in, LineSet& out) {
+    __m256i fit[kMaxShapeSide + 1][kMaxSide], hit[kMaxShapeSide + 1][kMaxSide];
+    const int r0 = std::max(0, in.lo - in.maxHeight + 1);
+    const int r1 = std::min(in.rows - 1, in.hi + in.maxHeight - 1);
+    for (int r = r0; r <= r1; ++r) {
+        const __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(&in.anchors[r]));
+        const __m256i free = _mm256_or_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(&in.neutral[r])), a);
+        fit[1][r] = free;
+        hit[1][r] = a;
+        for (int len = 2; len <= in.maxLength; ++len) {
+            const __m128i shift = _mm_cvtsi32_si128(len - 1);
+            fit[len][r] = _mm256_and_si256(fit[len - 1][r], _mm256_srl_epi32(free, shift));
+            hit[len][r] = _mm256_or_si256(hit[len - 1][r], _mm256_srl_epi32(a, shift));
+        }
+    }
+
+    __m256i moves = _mm256_setzero_si256();
+    int count = 0;
+    for (int i = 0; i < in.kernelCount; ++i) {
+        const SegmentTable::Kernel& k = in.kernels[i];
+        const int maxY = std::min(in.rows - k.height, in.hi);
+        if (k.width > in.cols) continue;
+        const __m256i xMask = _mm256_set1_epi32(static_cast<int>(columnsMask(in.cols - k.width + 1)));
+        const Segment* seg = in.segments + k.first;
+        for (int y = std::max(0, in.lo - k.height + 1); y <= maxY; ++y) {
+            __m256i ok = xMask, touch = _mm256_setzero_si256();
+            for (int s = 0; s < k.count; ++s) {
+                const __m128i shift = _mm_cvtsi32_si128(seg[s].dx);
+                ok = _mm256_and_si256(ok, _mm256_srl_epi32(fit[seg[s].length][y + seg[s].dy], shift));
+                touch = _mm256_or_si256(touch, _mm256_srl_epi32(hit[seg[s].length][y + seg[s].dy], shift));
+            }
+            ok = _mm256_and_si256(ok, touch);
+            moves = _mm256_add_epi32(moves, popCount8(ok));
+            _mm256_store_si256(reinterpret_cast<__m256i*>(&out.origins[count]), ok);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(&out.end[count]), moves);
+            out.orientation[count] = static_cast<std::uint8_t>(i);
+            out.y[count] = static_cast<std::uint8_t>(y);
+            count += !_mm256_testz_si256(ok, ok);
+        }
+    }
+    return count;
+}
+
+#endif
+
+} // namespace
+
+/**
+ * @struct BatchPlayout::Group
+ * @brief kBatchLanes parties au même pas, et les lignes de leurs masques que lit la validation,
+ *        entrelacées à chaque tour.
+ */
+struct BatchPlayout::Group {
+    std::array<Position, kBatchLanes> games;
+    /// Parties réelles du groupe (les voies suivantes répètent la dernière et ne sont pas jouées).
+    int lanes = 0;
+    std::array<Lanes, kMaxSide> neutral, anchors;
+
+    /**
+     * @brief Entrelace les cases neutres et les ancres du siège de chaque partie.
+     * @return false si aucune partie n’a d’ancre ; sinon [lo, hi] : lignes extrêmes des ancres.
+     */
+    bool gather(int seat, int& lo, int& hi) {
+        const int rows = games[0].rows();
+        lo = rows;
+        hi = -1;
+        for (int y = 0; y < rows; ++y) {
+            Row any = 0;
+            for (int l = 0; l < kBatchLanes; ++l) {
+                neutral[y].v[l] = games[l].neutral()[y];
+                anchors[y].v[l] = games[l].anchors(seat)[y];
+                any |= anchors[y].v[l];
+            }
+            if (any) {
+                lo = std::min(lo, y);
+                hi = y;
+            }
+        }
+        return lo <= hi;
+    }
+};
+
+BatchPlayout::BatchPlayout(const std::vector<ShapeSet>& catalog) : table_(catalog) {}
+
+void BatchPlayout::setCatalog(const std::vector<ShapeSet>& catalog) {
+    table_.setCatalog(catalog);
+}
+
+bool BatchPlayout::avx2Available() {
+#if BATCH_AVX2 && defined(__GNUC__)
+    return __builtin_cpu_supports("avx2");
+#elif BATCH_AVX2
+    int info[4];
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] >> 27) & 1;
+    __cpuidex(info, 7, 0);
+    return osxsave && ((info[1] >> 5) & 1) && (_xgetbv(0) & 6) == 6;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Lignes d’origines légales de tout le groupe (noyau AVX2 ou scalaire), puis, dans
+ *        chaque partie, tirage d’un placement par recherche dichotomique dans les nombres
+ *        cumulés de sa voie et pose par Position::place.
+ */
+void BatchPlayout::playRandom_(Group& g, int tile, FastRng& rng) const {
+    const Position& ref = g.games[0];
+    const int seat = ref.toMove();
+    int lo, hi;
+    if (!g.gather(seat, lo, hi)) return;
+
+    const SegmentTable::TileInfo& info = table_.tile(tile);
+    const KernelInput in{ g.neutral.data(), g.anchors.data(), ref.rows(), ref.cols(), lo, hi,
+                          table_.kernels() + info.first, info.count, table_.segments(),
+                          info.maxLength, info.maxHeight };
+    LineSet lines;
+#if BATCH_AVX2
+    const int count = avx2_ ? collectAvx2(in, lines) : collectScalar(in, lines);
+#else
+    const int count = collectScalar(in, lines);
+#endif
+    if (count == 0) return;
+
+    for (int l = 0; l < g.lanes; ++l) {
+        const Row moves = lines.end[count - 1].v[l];
+        if (moves == 0) continue;
+        const Row k = rng.below(moves);
+        int a = 0, b = count - 1;
+        while (a < b) {
+            const int mid = (a + b) / 2;
+            if (lines.end[mid].v[l] > k) b = mid;
+            else a = mid + 1;
+        }
+        const Row first = a > 0 ? lines.end[a - 1].v[l] : 0;
+        const int x = selectBit(lines.origins[a].v[l], static_cast<int>(k - first));
+        g.games[l].place(seat, table_.orientation(tile, lines.orientation[a]), x, lines.y[a]);
+    }
+}
+
+void BatchPlayout::run(const std::vector<Position>& starts, const TileBag& bag, FastRng& rng,
+                       std::vector<std::array<SeatScore, kMaxPlayers>>& scores) const {
+    scores.assign(starts.size(), {});
+    if (starts.empty()) return;
+    const Position& ref = starts.front();
+    for (const Position& p : starts) {
+        if (p.rows() != ref.rows() || p.cols() != ref.cols() || p.numSeats() != ref.numSeats()
+            || p.round() != ref.round() || p.toMove() != ref.toMove())
+            throw std::invalid_argument("BatchPlayout: positions must share board, seats, round and seat to move");
+    }
+
+    auto group = std::make_unique<Group>();
+    Group& g = *group;
+    const int n = static_cast<int>(starts.size());
+    for (int base = 0; base < n; base += kBatchLanes) {
+        g.lanes = std::min(kBatchLanes, n - base);
+        for (int l = 0; l < kBatchLanes; ++l) g.games[l] = starts[base + std::min(l, g.lanes - 1)];
+        TileBag b = bag;
+        b.determinize(rng);
+
+        while (!g.games[0].roundsOver()) {
+            for (int l = 0; l < g.lanes; ++l) Playout::playRock(g.games[l], rng);
+            playRandom_(g, b.draw(rng), rng);
+            for (int l = 0; l < g.lanes; ++l) g.games[l].endTurn();
+        }
+        for (int l = 0; l < g.lanes; ++l) scores[base + l] = Playout::finish(g.games[l], rng);
+    }
+}
@@ -0,0 +1,149 @@
+/**
+* @file Coverage.cpp
+ * @brief Implémentation de Coverage — couverture des cases par convolution de masques.
+ */
+
+#include "../../include/Engine/Coverage.hpp"
+#include <algorithm>
+
+Coverage::Coverage(std::vector<ShapeSet> shapes) : shapes_(std::move(shapes)) {}
+
+void Coverage::compute(const Position& position) {
+    rows_ = position.rows();
+    cols_ = position.cols();
+    seats_ = position.numSeats();
+    for (int s = 0; s < seats_; ++s) {
+        masks_[s] = position.masks(s);
+        rebuildRows_(s, 0, rows_ - 1);
+    }
+}
+
+/**
+ * @brief Pour chaque orientation, seules les origines des lignes [d0 − h + 1, d1] sont
+ *        réévaluées avec les anciens et les nouveaux masques ; les origines perdues sont
+ *        soustraites des compteurs et les nouvelles ajoutées (les autres sont inchangées).
+ */
+void Coverage::update(const Position& position) {
+    if (position.rows() != rows_ || position.cols() != cols_ || position.numSeats() != seats_) {
+        compute(position);
+        return;
+    }
+    for (int s = 0; s < seats_; ++s) {
+        const PlacementMasks next = position.masks(s);
+        int d0 = rows_, d1 = -1;
+        for (int y = 0; y < rows_; ++y) {
+            if (next.free[y] != masks_[s].free[y] || next.anchors[y] != masks_[s].anchors[y]) {
+                d0 = std::min(d0, y);
+                d1 = y;
+            }
+        }
+        if (d1 < 0) continue;
+        for (const ShapeSet& shape : shapes_) {
+            for (const Orientation& o : shape.orientations()) {
+                const int maxX = cols_ - o.width;
+                const int maxY = std::min(rows_ - o.height, d1);
+                if (maxX < 0) continue;
+                const Row xMask = columnsMask(maxX + 1);
+                for (int y = std::max(0, d0 - o.height + 1); y <= maxY; ++y) {
+                    const Row before = MoveGenerator::legalRow(masks_[s], o, y, xMask);
+                    const Row after = MoveGenerator::legalRow(next, o, y, xMask);
+                    if (before == after) continue;
+                    addOrigins_(s, o, y, before & ~after, -1);
+                    addOrigins_(s, o, y, after & ~before, +1);
+                }
+            }
+        }
+        masks_[s] = next;
+    }
+}
+
+/**
+ * @brief Le masque `bits` (origines décalées de dx) est ajouté au compteur de la ligne
+ *        y + dy plan par plan : somme = bits ^ plan, retenue = bits & plan (emprunt =
+ *        bits & ~plan pour une soustraction).
+ */
+void Coverage::addOrigins_(int seat, const Orientation& o, int y, Row origins, int sign, int r0, int r1) {
+    if (!origins) return;
+    Planes& planes = planes_[seat];
+    for (int i = 0; i < o.cellCount; ++i) {
+        const auto [dx, dy] = o.cells[i];
+        const int row = y + dy;
+        if (row < r0 || row > r1) continue;
+        Row bits = origins << dx;
+        for (int k = 0; k < kPlanes && bits; ++k) {
+            const Row carry = (sign > 0 ? planes[k][row] : ~planes[k][row]) & bits;
+            planes[k][row] ^= bits;
+            bits = carry;
+        }
+    }
+}
+
+/**
+ * @brief Les compteurs des lignes [r0, r1] sont remis à zéro, puis chaque origine légale
+ *        dont la forme touche ces lignes y ajoute ses cases.
+ */
+void Coverage::rebuildRows_(int seat, int r0, int r1) {
+    for (BitGrid& plane : planes_[seat])
+        for (int y = r0; y <= r1; ++y) plane[y] = 0;
+
+    const PlacementMasks& masks = masks_[seat];
+    for (const ShapeSet& shape : shapes_) {
+        for (const Orientation& o : shape.orientations()) {
+            const int maxX = cols_ - o.width;
+            const int maxY = std::min(rows_ - o.height, r1);
+            if (maxX < 0) continue;
+            const Row xMask = columnsMask(maxX + 1);
+            for (int y = std::max(0, r0 - o.height + 1); y <= maxY; ++y)
+                addOrigins_(seat, o, y, MoveGenerator::legalRow(masks, o, y, xMask), +1, r0, r1);
+        }
+    }
+}
+
+int Coverage::count(int seat, int x, int y) const {
+    int n = 0;
+    for (int k = 0; k < kPlanes; ++k) n |= static_cast<int>((planes_[seat][k][y] >> x) & 1u) << k;
+    return n;
+}
+
+BitGrid Coverage::covered(int seat) const {
+    BitGrid out{};
+    for (const BitGrid& plane : planes_[seat])
+        for (int y = 0; y < rows_; ++y) out[y] |= plane[y];
+    return out;
+}
+
+std::vector<std::vector<int>> Coverage::grid(int seat) const {
+    std::vector<std::vector<int>> out(rows_, std::vector<int>(cols_, 0));
+    for (int k = 0; k < kPlanes; ++k) {
+        for (int y = 0; y < rows_; ++y) {
+            for (Row r = planes_[seat][k][y]; r; r &= r - 1) out[y][lowestBit(r)] |= 1 << k;
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief La somme des couvertures se lit plan par plan (2^k × cases du plan k) ; le
+ *        maximum, case par case sur les seules cases couvertes.
+ */
+Coverage::Features Coverage::features(int seat) const {
+    Features f;
+    const BitGrid mine = covered(seat);
+    BitGrid others{};
+    for (int s = 0; s < seats_; ++s) {
+        if (s == seat) continue;
+        const BitGrid c = covered(s);
+        for (int y = 0; y < rows_; ++y) others[y] |= c[y];
+    }
+    for (int y = 0; y < rows_; ++y) {
+        f.coveredCells += popCount(mine[y]);
+        f.exclusiveCells += popCount(mine[y] & ~others[y]);
+        for (Row r = mine[y]; r; r &= r - 1) f.maxCoverage = std::max(f.maxCoverage, count(seat, lowestBit(r), y));
+    }
+    for (int k = 0; k < kPlanes; ++k) {
+        long cells = 0;
+        for (int y = 0; y < rows_; ++y) cells += popCount(planes_[seat][k][y]);
+        f.totalCoverage += cells << k;
+    }
+    return f;
+}
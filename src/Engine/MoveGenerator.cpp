@@ -0,0 +1,193 @@
+/**
+* @file MoveGenerator.cpp
+ * @brief Implémentation de MoveGenerator — génération des placements légaux par masques de bits.
+ */
+
+#include "../../include/Engine/MoveGenerator.hpp"
+#include "../../include/Board/Board.hpp"
+#include <algorithm>
+
+/**
+ * @brief Construit `free` et `anchors` à partir de la frontière tenue par le plateau.
+ *
+ * Les cases libres pour le joueur sont les cases neutres et ses propres ancres :
+ * O(lignes), sans parcourir la grille.
+ *
+ * @param board Plateau.
+ * @param playerId Identifiant du joueur.
+ * @return Masques de placement.
+ */
+PlacementMasks MoveGenerator::masksFor(const Board& board, int playerId) {
+    PlacementMasks m;
+    m.rows = std::min(board.getRows(), kMaxSide);
+    m.cols = std::min(board.getCols(), kMaxSide);
+    const BitGrid& neutral = board.getNeutral();
+    const BitGrid& anchors = board.getAnchors(playerId);
+    for (int y = 0; y < m.rows; ++y) {
+        m.anchors[y] = anchors[y];
+        m.free[y] = neutral[y] | anchors[y];
+    }
+    return m;
+}
+
+/**
+ * @brief Origines légales d’une ligne pour une orientation.
+ *
+ * Pour chaque case (dx, dy) de la forme, `free[y+dy] >> dx` indique les origines x dont
+ * cette case tombe sur une case libre : on les intersecte toutes. L’union des
+ * `anchors[y+dy] >> dx` donne les origines touchant le territoire du joueur.
+ *
+ * @param masks Masques du joueur.
+ * @param o Orientation.
+ * @param y Ligne d’origine.
+ * @param xMask Origines admissibles (la forme ne déborde pas à droite).
+ * @return Masque des origines légales.
+ */
+Row MoveGenerator::legalRow(const PlacementMasks& masks, const Orientation& o, int y, Row xMask) {
+    Row ok = xMask, touch = 0;
+    for (int i = 0; i < o.cellCount && ok; ++i) {
+        const auto [dx, dy] = o.cells[i];
+        ok &= masks.free[y + dy] >> dx;
+        touch |= masks.anchors[y + dy] >> dx;
+    }
+    return ok & touch;
+}
+
+/**
+ * @brief Lignes extrêmes contenant au moins une ancre.
+ *
+ * Seules les origines dont la forme recouvre l’une de ces lignes peuvent être légales :
+ * les générateurs restreignent leur balayage à cet intervalle.
+ *
+ * @param masks Masques du joueur.
+ * @param lo Sortie : première ligne avec une ancre.
+ * @param hi Sortie : dernière ligne avec une ancre.
+ * @return false s’il n’y a aucune ancre.
+ */
+static bool anchorSpan(const PlacementMasks& masks, int& lo, int& hi) {
+    lo = 0;
+    while (lo < masks.rows && !masks.anchors[lo]) ++lo;
+    if (lo == masks.rows) return false;
+    hi = masks.rows - 1;
+    while (!masks.anchors[hi]) --hi;
+    return true;
+}
+
+/**
+ * @brief Origines légales d’une orientation sur tout le plateau (balayage limité, comme
+ *        generate(), aux lignes dont la forme peut toucher une ancre).
+ * @param masks Masques du joueur.
+ * @param o Orientation.
+ * @return Grille des origines légales.
+ */
+BitGrid MoveGenerator::legalOrigins(const PlacementMasks& masks, const Orientation& o) {
+    BitGrid out{};
+    int lo, hi;
+    if (!anchorSpan(masks, lo, hi)) return out;
+    const int maxX = masks.cols - o.width;
+    const int maxY = std::min(masks.rows - o.height, hi);
+    if (maxX < 0 || maxY < 0) return out;
+    const Row xMask = columnsMask(maxX + 1);
+    for (int y = std::max(0, lo - o.height + 1); y <= maxY; ++y) out[y] = legalRow(masks, o, y, xMask);
+    return out;
+}
+
+/**
+ * @brief Énumère les placements légaux de toutes les orientations.
+ * @param masks Masques du joueur.
+ * @param shape Orientations de la tuile.
+ * @param out Liste de sortie.
+ */
+void MoveGenerator::generate(const PlacementMasks& masks, const ShapeSet& shape, MoveList& out) {
+    out.clear();
+    int lo, hi;
+    if (!anchorSpan(masks, lo, hi)) return;
+    const auto& orients = shape.orientations();
+    for (std::size_t oi = 0; oi < orients.size(); ++oi) {
+        const Orientation& o = orients[oi];
+        const int maxX = masks.cols - o.width;
+        const int maxY = std::min(masks.rows - o.height, hi);
+        if (maxX < 0 || maxY < 0) continue;
+        const Row xMask = columnsMask(maxX + 1);
+        for (int y = std::max(0, lo - o.height + 1); y <= maxY; ++y) {
+            Row legal = legalRow(masks, o, y, xMask);
+            while (legal) {
+                int x = lowestBit(legal);
+                legal &= legal - 1;
+                out.push({ static_cast<std::uint8_t>(oi), static_cast<std::uint8_t>(x), static_cast<std::uint8_t>(y) });
+            }
+        }
+    }
+}
+
+/**
+ * @brief Énumère les placements légaux à partir du plateau.
+ * @param board Plateau.
+ * @param playerId Identifiant du joueur.
+ * @param shape Orientations de la tuile.
+ * @param out Liste de sortie.
+ */
+void MoveGenerator::generate(const Board& board, int playerId, const ShapeSet& shape, MoveList& out) {
+    generate(masksFor(board, playerId), shape, out);
+}
+
+/**
+ * @brief Compte les placements légaux (population des masques d’origines).
+ * @param masks Masques du joueur.
+ * @param shape Orientations de la tuile.
+ * @return Nombre de placements légaux.
+ */
+std::size_t MoveGenerator::countMoves(const PlacementMasks& masks, const ShapeSet& shape) {
+    std::size_t n = 0;
+    int lo, hi;
+    if (!anchorSpan(masks, lo, hi)) return 0;
+    for (const auto& o : shape.orientations()) {
+        const int maxX = masks.cols - o.width;
+        const int maxY = std::min(masks.rows - o.height, hi);
+        if (maxX < 0 || maxY < 0) continue;
+        const Row xMask = columnsMask(maxX + 1);
+        for (int y = std::max(0, lo - o.height + 1); y <= maxY; ++y) n += popCount(legalRow(masks, o, y, xMask));
+    }
+    return n;
+}
+
+/**
+ * @brief Cherche un placement légal, en s’arrêtant au premier.
+ *
+ * Les lignes sans aucune ancre dans la hauteur de la forme sont sautées.
+ *
+ * @param masks Masques du joueur.
+ * @param shape Orientations de la tuile.
+ * @return true si au moins un placement est légal.
+ */
+bool MoveGenerator::hasAnyMove(const PlacementMasks& masks, const ShapeSet& shape) {
+    for (const auto& o : shape.orientations()) {
+        const int maxX = masks.cols - o.width;
+        const int maxY = masks.rows - o.height;
+        if (maxX < 0 || maxY < 0) continue;
+        const Row xMask = columnsMask(maxX + 1);
+        for (int y = 0; y <= maxY; ++y) {
+            Row any = 0;
+            for (int dy = 0; dy < o.height; ++dy) any |= masks.anchors[y + dy];
+            if (!any) continue;
+            if (legalRow(masks, o, y, xMask)) return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Convertit un coup en coordonnées absolues.
+ * @param shape Orientations de la tuile.
+ * @param m Coup.
+ * @return Cases occupées.
+ */
+std::vector<std::pair<int,int>> MoveGenerator::footprint(const ShapeSet& shape, const Move& m) {
+    const Orientation& o = shape.orientations()[m.orientation];
+    std::vector<std::pair<int,int>> pts;
+    pts.reserve(o.cellCount);
+    for (int i = 0; i < o.cellCount; ++i) {
+        pts.emplace_back(m.x + o.cells[i].first, m.y + o.cells[i].second);
+    }
+    return pts;
+}
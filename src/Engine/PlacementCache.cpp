@@ -0,0 +1,124 @@
+/**
+* @file PlacementCache.cpp
+ * @brief Implémentation de PlacementCache — revalidation des origines légales par zones modifiées.
+ */
+
+#include "../../include/Engine/PlacementCache.hpp"
+#include <algorithm>
+
+/**
+ * @brief Met à jour toutes les orientations d’une tuile pour un joueur.
+ *
+ * Pour chaque orientation de taille (w, h) et chaque zone modifiée [x0..x1]×[y0..y1],
+ * les origines concernées sont x ∈ [x0-w+1, x1] et y ∈ [y0-h+1, y1] : ces lignes sont
+ * recalculées par MoveGenerator::legalRow puis recombinées sous le masque de colonnes.
+ * Une zone est ignorée si elle ne contenait aucune origine légale et si aucune ancre du
+ * joueur ne se trouve sous les origines concernées (aucune ne peut être devenue légale).
+ *
+ * @param playerId Identifiant du joueur.
+ * @param shape Orientations de la tuile.
+ * @return Entrées à jour.
+ */
+std::vector<PlacementCache::Entry>& PlacementCache::refresh(int playerId, const ShapeSet& shape) {
+    auto slot = slots_.emplace(shape.tileId(), static_cast<std::uint32_t>(slots_.size())).first->second;
+    auto& entries = entries_[(static_cast<std::uint64_t>(static_cast<std::uint32_t>(playerId)) << 32) | slot];
+    const auto& orients = shape.orientations();
+    if (entries.size() != orients.size()) entries.assign(orients.size(), Entry{});
+
+    const std::uint64_t now = board_.getVersion();
+    if (entries.front().valid && entries.front().version == now) {
+        ++stats_.hits;
+        return entries;
+    }
+
+    const PlacementMasks masks = MoveGenerator::masksFor(board_, playerId);
+    const bool incremental = entries.front().valid && board_.dirtySince(entries.front().version, dirty_);
+
+    for (std::size_t oi = 0; oi < orients.size(); ++oi) {
+        const Orientation& o = orients[oi];
+        Entry& e = entries[oi];
+        e.version = now;
+        e.valid = true;
+        if (!incremental) {
+            e.origins = MoveGenerator::legalOrigins(masks, o);
+            e.count = 0;
+            for (int y = 0; y < masks.rows; ++y) e.count += popCount(e.origins[y]);
+            stats_.rowsRevalidated += static_cast<std::size_t>(std::max(0, masks.rows - o.height + 1));
+            continue;
+        }
+        const int maxX = masks.cols - o.width;
+        const int maxY = masks.rows - o.height;
+        if (maxX < 0 || maxY < 0) continue;
+        const Row xMask = columnsMask(maxX + 1);
+        for (const DirtyRect& r : dirty_) {
+            const int ox0 = std::max(0, r.x0 - o.width + 1);
+            const int ox1 = std::min(maxX, r.x1);
+            const int oy0 = std::max(0, r.y0 - o.height + 1);
+            const int oy1 = std::min(maxY, r.y1);
+            if (ox0 > ox1 || oy0 > oy1) continue;
+            const Row cm = columnsMask(ox1 + 1) & ~columnsMask(ox0);
+
+            Row before = 0, reach = 0;
+            for (int y = oy0; y <= oy1; ++y) before |= e.origins[y] & cm;
+            for (int y = oy0; y < oy1 + o.height; ++y) reach |= masks.anchors[y];
+            if (!before && !(reach & (columnsMask(ox1 + o.width) & ~columnsMask(ox0)))) continue;
+
+            for (int y = oy0; y <= oy1; ++y) {
+                const Row fresh = MoveGenerator::legalRow(masks, o, y, xMask & cm);
+                const Row old = e.origins[y] & cm;
+                e.count += static_cast<std::size_t>(popCount(fresh));
+                e.count -= static_cast<std::size_t>(popCount(old));
+                e.origins[y] = (e.origins[y] & ~cm) | fresh;
+                ++stats_.rowsRevalidated;
+            }
+        }
+    }
+    if (incremental) ++stats_.incrementalUpdates;
+    else ++stats_.fullRebuilds;
+    return entries;
+}
+
+/**
+ * @brief Origines légales d’une orientation, à jour du plateau.
+ * @param playerId Identifiant du joueur.
+ * @param shape Orientations de la tuile.
+ * @param orientation Indice d’orientation.
+ * @return Grille des origines légales.
+ */
+const BitGrid& PlacementCache::legalOrigins(int playerId, const ShapeSet& shape, int orientation) {
+    return refresh(playerId, shape)[orientation].origins;
+}
+
+/**
+ * @brief Énumère les placements légaux d’une tuile à partir des grilles en cache.
+ * @param playerId Identifiant du joueur.
+ * @param shape Orientations de la tuile.
+ * @param out Liste de sortie.
+ */
+void PlacementCache::generate(int playerId, const ShapeSet& shape, MoveList& out) {
+    out.clear();
+    const auto& entries = refresh(playerId, shape);
+    const int rows = std::min(board_.getRows(), kMaxSide);
+    for (std::size_t oi = 0; oi < entries.size(); ++oi) {
+        for (int y = 0; y < rows; ++y) {
+            Row legal = entries[oi].origins[y];
+            while (legal) {
+                int x = lowestBit(legal);
+                legal &= legal - 1;
+                out.push({ static_cast<std::uint8_t>(oi), static_cast<std::uint8_t>(x), static_cast<std::uint8_t>(y) });
+            }
+        }
+    }
+}
+
+/**
+ * @brief Nombre de placements légaux d’une tuile (compteurs tenus à jour par refresh()).
+ * @param playerId Identifiant du joueur.
+ * @param shape Orientations de la tuile.
+ * @return Nombre de placements légaux.
+ */
+std::size_t PlacementCache::countMoves(int playerId, const ShapeSet& shape) {
+    std::size_t n = 0;
+    for (const auto& e : refresh(playerId, shape)) n += e.count;
+    return n;
+}
@@ -0,0 +1,138 @@
+/**
+* @file Playout.cpp
+ * @brief Implémentation de Playout — parties simulées rapides.
+ */
+
+#include "../../include/Engine/Playout.hpp"
+#include <algorithm>
+
+namespace {
+
+/**
+ * @brief Tire une case uniforme d’un masque.
+ * @return false si le masque est vide.
+ */
+bool randomCell(const BitGrid& mask, int rows, FastRng& rng, int& x, int& y) {
+    std::array<int, kMaxSide> perRow{};
+    int total = 0;
+    for (int r = 0; r < rows; ++r) {
+        if (mask[r]) perRow[r] = popCount(mask[r]);
+        total += perRow[r];
+    }
+    if (total == 0) return false;
+    int k = static_cast<int>(rng.below(static_cast<std::uint32_t>(total)));
+    for (y = 0; k >= perRow[y]; ++y) k -= perRow[y];
+    x = selectBit(mask[y], k);
+    return true;
+}
+
+} // namespace
+
+Playout::Playout(const std::vector<ShapeSet>& catalog) : table_(catalog) {}
+
+void Playout::setCatalog(const std::vector<ShapeSet>& catalog) {
+    table_.setCatalog(catalog);
+}
+
+/**
+ * @brief `fit[L][r]` : origines x où les cases x .. x + L − 1 de la ligne r sont libres ;
+ *        `hit[L][r]` : origines où l’une d’elles est une ancre. Seules les lignes que la
+ *        tuile peut couvrir en touchant une ancre sont calculées.
+ *        Les lignes d’origines légales sont rangées dans un tableau de pile et un placement
+ *        y est tiré uniformément.
+ */
+bool Playout::playRandom(Position& pos, int tile, FastRng& rng) const {
+    const int seat = pos.toMove();
+    const int rows = pos.rows(), cols = pos.cols();
+    const BitGrid& anchors = pos.anchors(seat);
+    const BitGrid& neutral = pos.neutral();
+    int lo = 0, hi = rows - 1;
+    while (lo < rows && !anchors[lo]) ++lo;
+    while (hi >= lo && !anchors[hi]) --hi;
+    if (lo > hi) return false;
+
+    const SegmentTable::TileInfo& info = table_.tile(tile);
+    const int r0 = std::max(0, lo - info.maxHeight + 1);
+    const int r1 = std::min(rows - 1, hi + info.maxHeight - 1);
+    std::array<BitGrid, kMaxShapeSide + 1> fit, hit;
+    for (int r = r0; r <= r1; ++r) {
+        const Row free = neutral[r] | anchors[r];
+        fit[1][r] = free;
+        hit[1][r] = anchors[r];
+        for (int l = 2; l <= info.maxLength; ++l) {
+            fit[l][r] = fit[l - 1][r] & (free >> (l - 1));
+            hit[l][r] = hit[l - 1][r] | (anchors[r] >> (l - 1));
+        }
+    }
+
+    // Origines légales d’une ligne ; `end` : placements cumulés jusqu’à elle incluse.
+    struct Line { std::uint8_t orientation, y; std::uint16_t end; Row origins; };
+    std::array<Line, 8 * kMaxSide> lines;
+    int count = 0, moves = 0;
+    for (int i = 0; i < info.count; ++i) {
+        const SegmentTable::Kernel& k = table_.kernels()[info.first + i];
+        const int maxY = std::min(rows - k.height, hi);
+        if (k.width > cols) continue;
+        const Row xMask = columnsMask(cols - k.width + 1);
+        const Segment* seg = table_.segments() + k.first;
+        for (int y = std::max(0, lo - k.height + 1); y <= maxY; ++y) {
+            Row ok = xMask, touch = 0;
+            for (int s = 0; s < k.count; ++s) {
+                ok &= fit[seg[s].length][y + seg[s].dy] >> seg[s].dx;
+                touch |= hit[seg[s].length][y + seg[s].dy] >> seg[s].dx;
+            }
+            ok &= touch;
+            // Écriture sans branchement : la ligne n’est conservée que si ok est non nul.
+            moves += popCount(ok);
+            lines[count] = { static_cast<std::uint8_t>(i), static_cast<std::uint8_t>(y),
+                             static_cast<std::uint16_t>(moves), ok };
+            count += ok != 0;
+        }
+    }
+    if (moves == 0) return false;
+
+    const int k = static_cast<int>(rng.below(static_cast<std::uint32_t>(moves)));
+    int i = 0;
+    while (k >= lines[i].end) ++i;
+    const int first = i > 0 ? lines[i - 1].end : 0;
+    const Orientation& o = table_.orientation(tile, lines[i].orientation);
+    pos.place(seat, o, selectBit(lines[i].origins, k - first), lines[i].y);
+    return true;
+}
+
+std::array<SeatScore, kMaxPlayers> Playout::run(Position& pos, TileBag& bag, int tile, FastRng& rng) const {
+    while (tile >= 0 && !pos.roundsOver()) {
+        playRandom(pos, tile, rng);
+        pos.endTurn();
+        if (pos.roundsOver()) break;
+        playRock(pos, rng);
+        tile = bag.draw(rng);
+    }
+    return finish(pos, rng);
+}
+
+void Playout::playRock(Position& pos, FastRng& rng) {
+    const int seat = pos.toMove();
+    if (!pos.rockPending(seat)) return;
+    BitGrid targets{};
+    for (int s = 0; s < pos.numSeats(); ++s) {
+        if (s == seat) continue;
+        for (int y = 0; y < pos.rows(); ++y) targets[y] |= pos.anchors(s)[y];
+    }
+    int x, y;
+    if (randomCell(targets, pos.rows(), rng, x, y)) pos.placeStone(x, y);
+    pos.clearRock(seat);
+}
+
+std::array<SeatScore, kMaxPlayers> Playout::finish(Position& pos, FastRng& rng) {
+    std::array<SeatScore, kMaxPlayers> scores{};
+    for (int seat = 0; seat < pos.numSeats(); ++seat) {
+        int x, y;
+        if (pos.coupons(seat) > 0 && randomCell(pos.anchors(seat), pos.rows(), rng, x, y)) {
+            pos.placeCell(seat, x, y);
+            pos.useCoupon(seat);
+        }
+    }
+    for (int seat = 0; seat < pos.numSeats(); ++seat) scores[seat] = pos.score(seat);
+    return scores;
+}
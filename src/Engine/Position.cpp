@@ -0,0 +1,284 @@
+/**
+* @file Position.cpp
+ * @brief Implémentation de Position — état de partie compact pour la simulation.
+ */
+
+#include "../../include/Engine/Position.hpp"
+#include "../../include/Board/Board.hpp"
+#include "../../include/Player/Player.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Copie le plateau (grilles, frontière, bonus) et l’état des joueurs.
+ * @param board Plateau.
+ * @param players Joueurs dans l’ordre de jeu.
+ * @param round Manche en cours.
+ * @param seat Siège dont c’est le tour.
+ * @return Position équivalente.
+ */
+Position Position::fromBoard(const Board& board, const std::vector<Player>& players, int round, int seat) {
+    if (board.getRows() > kMaxSide || board.getCols() > kMaxSide)
+        throw std::invalid_argument("Position: board larger than 32x32");
+    if (players.size() > static_cast<std::size_t>(kMaxPlayers))
+        throw std::invalid_argument("Position: too many players");
+
+    Position p;
+    p.rows_ = static_cast<std::int8_t>(board.getRows());
+    p.cols_ = static_cast<std::int8_t>(board.getCols());
+    p.numSeats_ = static_cast<std::int8_t>(players.size());
+    p.round_ = static_cast<std::int8_t>(round);
+    p.toMove_ = static_cast<std::int8_t>(seat);
+
+    for (int s = 0; s < p.numSeats_; ++s) {
+        const Player& pl = players[s];
+        p.playerIds_[s] = pl.getID();
+        p.coupons_[s] = static_cast<std::uint8_t>(std::min(pl.getExchangeCoupons(), 255));
+        p.rockPending_[s] = pl.hasRockBonus();
+        const BitGrid& a = board.getAnchors(pl.getID());
+        for (int y = 0; y < p.rows_; ++y) p.anchors_[s][y] = a[y];
+    }
+
+    const auto& grid = board.getGrid();
+    const auto& owners = board.getOwnerGrid();
+    for (int y = 0; y < p.rows_; ++y) {
+        p.neutral_[y] = board.getNeutral()[y];
+        for (int x = 0; x < p.cols_; ++x) {
+            const Row bit = Row(1) << x;
+            if (grid[y][x] == '.') p.empty_[y] |= bit;
+            const int s = p.seatOf(owners[y][x]);
+            if (owners[y][x] != 0 && s >= 0) p.owned_[s][y] |= bit;
+        }
+    }
+
+    for (const auto& [pos, bonus] : board.getBonus()) {
+        if (p.bonusCount_ >= kMaxBonuses) break;
+        BonusCell& b = p.bonuses_[p.bonusCount_++];
+        b.x = static_cast<std::uint8_t>(pos.first);
+        b.y = static_cast<std::uint8_t>(pos.second);
+        const std::string sym = bonus->getSymbol();
+        b.kind = sym == "E" ? BonusKind::Exchange : sym == "R" ? BonusKind::Rock : BonusKind::Steal;
+    }
+    p.refreshBonuses_(0, p.rows_ - 1);
+    return p;
+}
+
+int Position::seatOf(int playerId) const {
+    for (int s = 0; s < numSeats_; ++s)
+        if (playerIds_[s] == playerId) return s;
+    return -1;
+}
+
+void Position::endTurn() {
+    if (++toMove_ >= numSeats_) {
+        toMove_ = 0;
+        ++round_;
+    }
+}
+
+PlacementMasks Position::masks(int seat) const {
+    PlacementMasks m;
+    m.rows = rows_;
+    m.cols = cols_;
+    const BitGrid& a = anchors_[seat];
+    for (int y = 0; y < rows_; ++y) {
+        m.anchors[y] = a[y];
+        m.free[y] = neutral_[y] | a[y];
+    }
+    return m;
+}
+
+/**
+ * @brief Pose les cases de l’orientation ligne par ligne (bit dx de `o.rows[dy]` décalé de x).
+ */
+int Position::place(int seat, const Orientation& o, int x, int y) {
+    BitGrid cells{};
+    for (int dy = 0; dy < o.height; ++dy) cells[y + dy] = o.rows[dy] << x;
+    claim_(seat, cells, y, y + o.height - 1);
+    return captureBonuses_(seat);
+}
+
+int Position::placeCell(int seat, int x, int y) {
+    BitGrid cells{};
+    cells[y] = Row(1) << x;
+    claim_(seat, cells, y, y);
+    return captureBonuses_(seat);
+}
+
+/**
+ * @brief Une pierre n’appartient à personne : seul le statut de sa propre case change.
+ */
+bool Position::placeStone(int x, int y) {
+    if (x < 0 || x >= cols_ || y < 0 || y >= rows_ || !isEmpty(x, y)) return false;
+    const Row keep = ~(Row(1) << x);
+    empty_[y] &= keep;
+    neutral_[y] &= keep;
+    for (int s = 0; s < numSeats_; ++s) anchors_[s][y] &= keep;
+    refreshBonuses_(y, y, Row(1) << x);
+    return true;
+}
+
+/**
+ * @brief Mise à jour par lignes : chaque case vide du halo ne peut que passer de neutre à
+ *        ancre du siège, ou d’ancre d’un autre siège à bloquée.
+ */
+void Position::claim_(int seat, const BitGrid& cells, int y0, int y1) {
+    const Row cm = columnsMask(cols_);
+    Row columns = 0;
+    for (int y = y0; y <= y1; ++y) {
+        const Row c = cells[y];
+        columns |= c;
+        const Row keep = ~c;
+        empty_[y] &= keep;
+        neutral_[y] &= keep;
+        owned_[seat][y] |= c;
+        for (int s = 0; s < numSeats_; ++s) anchors_[s][y] &= keep;
+    }
+    const int h0 = std::max(0, y0 - 1);
+    const int h1 = std::min<int>(rows_ - 1, y1 + 1);
+    for (int y = h0; y <= h1; ++y) {
+        Row halo = cells[y] << 1 | cells[y] >> 1;
+        if (y > 0) halo |= cells[y - 1];
+        if (y + 1 < rows_) halo |= cells[y + 1];
+        halo &= empty_[y] & cm;
+        if (!halo) continue;
+        anchors_[seat][y] |= neutral_[y] & halo;
+        neutral_[y] &= ~halo;
+        for (int s = 0; s < numSeats_; ++s)
+            if (s != seat) anchors_[s][y] &= ~halo;
+    }
+    // Cases changées : les cases posées et leur halo.
+    refreshBonuses_(h0, h1, columns | columns << 1 | columns >> 1);
+}
+
+/**
+ * @brief Même test que Board::checkBonusCapture : les quatre voisines appartiennent au siège.
+ *
+ * Une case bonus déjà recouverte par une tuile change de propriétaire (comme dans Board) ;
+ * ce cas rare reconstruit toute la frontière.
+ */
+int Position::captureBonuses_(int seat) {
+    const BitGrid& own = owned_[seat];
+    int captured = 0;
+    for (int i = 0; i < bonusCount_;) {
+        const int x = bonuses_[i].x, y = bonuses_[i].y;
+        const bool surrounded = x > 0 && y > 0 && x + 1 < cols_ && y + 1 < rows_
+            && ((own[y] >> (x - 1)) & 1u) && ((own[y] >> (x + 1)) & 1u)
+            && ((own[y - 1] >> x) & 1u) && ((own[y + 1] >> x) & 1u);
+        if (!surrounded) { ++i; continue; }
+
+        const Row bit = Row(1) << x;
+        if (isEmpty(x, y)) {
+            BitGrid cell{};
+            cell[y] = bit;
+            claim_(seat, cell, y, y);
+        } else {
+            for (int s = 0; s < numSeats_; ++s) owned_[s][y] &= ~bit;
+            owned_[seat][y] |= bit;
+            // Frontière recalculée à partir du territoire de chaque siège.
+            std::array<BitGrid, kMaxPlayers> adj{};
+            for (int s = 0; s < numSeats_; ++s) adj[s] = dilate(owned_[s], rows_, cols_);
+            for (int yy = 0; yy < rows_; ++yy) {
+                Row seen = 0, multi = 0;
+                for (int s = 0; s < numSeats_; ++s) {
+                    multi |= seen & adj[s][yy];
+                    seen |= adj[s][yy];
+                }
+                neutral_[yy] = empty_[yy] & ~seen;
+                for (int s = 0; s < numSeats_; ++s)
+                    anchors_[s][yy] = empty_[yy] & adj[s][yy] & ~multi;
+            }
+            refreshBonuses_(0, rows_ - 1);
+        }
+
+        switch (bonuses_[i].kind) {
+            case BonusKind::Exchange: if (coupons_[seat] < 255) ++coupons_[seat]; break;
+            case BonusKind::Rock:     rockPending_[seat] = true; break;
+            case BonusKind::Steal:    break;
+        }
+        bonuses_[i] = bonuses_[--bonusCount_];
+        bonusSides_[i] = bonusSides_[bonusCount_];
+        ++captured;
+    }
+    return captured;
+}
+
+/**
+ * @brief Une voisine vide est prenable par un siège si elle est neutre ou l’une de ses ancres ;
+ *        une voisine non vide ne compte que si elle lui appartient.
+ */
+void Position::refreshBonus_(int i) {
+    const int x = bonuses_[i].x, y = bonuses_[i].y;
+    const int sx[4] = {x - 1, x + 1, x, x};
+    const int sy[4] = {y, y, y - 1, y + 1};
+    std::array<std::uint8_t, kMaxPlayers>& sides = bonusSides_[i];
+    sides.fill(0);
+    for (int k = 0; k < 4; ++k) {
+        if (sx[k] < 0 || sy[k] < 0 || sx[k] >= cols_ || sy[k] >= rows_) {
+            for (int s = 0; s < numSeats_; ++s) sides[s] += 0x10;
+            continue;
+        }
+        const Row bit = Row(1) << sx[k];
+        const int row = sy[k];
+        for (int s = 0; s < numSeats_; ++s) {
+            if (owned_[s][row] & bit) sides[s] += 0x01;
+            else if (!(empty_[row] & (neutral_[row] | anchors_[s][row]) & bit)) sides[s] += 0x10;
+        }
+    }
+}
+
+/**
+ * @brief Un côté (x ± 1, y) ou (x, y ± 1) ne change que si sa case a changé : seuls les
+ *        bonus dont une colonne x − 1 .. x + 1 et une ligne y − 1 .. y + 1 en contiennent
+ *        une sont recalculés.
+ */
+void Position::refreshBonuses_(int y0, int y1, Row columns) {
+    const Row near = columns | columns << 1 | columns >> 1;
+    for (int i = 0; i < bonusCount_; ++i) {
+        const int y = bonuses_[i].y;
+        if (y + 1 >= y0 && y - 1 <= y1 && ((near >> bonuses_[i].x) & 1u)) refreshBonus_(i);
+    }
+}
+
+int Position::cellCount(int seat) const {
+    int n = 0;
+    for (int y = 0; y < rows_; ++y) n += popCount(owned_[seat][y]);
+    return n;
+}
+
+int Position::maxSquare(int seat) const {
+    BitGrid cur = owned_[seat];
+    int lo = 0, hi = rows_ - 1;
+    int side = 0;
+    while (true) {
+        while (lo <= hi && !cur[lo]) ++lo;
+        while (hi >= lo && !cur[hi]) --hi;
+        if (lo > hi) return side;
+        ++side;
+        for (int y = lo; y <= hi; ++y) {
+            const Row next = y + 1 <= hi ? cur[y + 1] : 0;
+            cur[y] = cur[y] & (cur[y] >> 1) & next & (next >> 1);
+        }
+    }
+}
+
+void Position::rewards(std::array<float, kMaxPlayers>& out) const {
+    std::array<SeatScore, kMaxPlayers> sc{};
+    for (int s = 0; s < numSeats_; ++s) sc[s] = score(s);
+    rewards(sc, numSeats_, out);
+}
+
+void Position::rewards(const std::array<SeatScore, kMaxPlayers>& sc, int numSeats,
+                       std::array<float, kMaxPlayers>& out) {
+    const float denom = numSeats > 1 ? float(numSeats - 1) : 1.0f;
+    for (int s = 0; s < numSeats; ++s) {
+        float beaten = 0.0f;
+        for (int t = 0; t < numSeats; ++t) {
+            if (t == s) continue;
+            if (sc[s].maxSquare != sc[t].maxSquare) beaten += sc[s].maxSquare > sc[t].maxSquare ? 1.0f : 0.0f;
+            else if (sc[s].cellCount != sc[t].cellCount) beaten += sc[s].cellCount > sc[t].cellCount ? 1.0f : 0.0f;
+            else beaten += 0.5f;
+        }
+        out[s] = beaten / denom;
+    }
+}
@@ -0,0 +1,29 @@
+/**
+* @file SegmentTable.cpp
+ * @brief Implémentation de SegmentTable — segments d’un catalogue rangés d’un seul bloc.
+ */
+
+#include "../../include/Engine/SegmentTable.hpp"
+#include <algorithm>
+
+SegmentTable::SegmentTable(const std::vector<ShapeSet>& catalog) {
+    setCatalog(catalog);
+}
+
+void SegmentTable::setCatalog(const std::vector<ShapeSet>& catalog) {
+    catalog_ = &catalog;
+    segments_.clear();
+    kernels_.clear();
+    tiles_.assign(catalog.size(), TileInfo{});
+    for (std::size_t t = 0; t < catalog.size(); ++t) {
+        TileInfo& info = tiles_[t];
+        info.first = static_cast<std::uint16_t>(kernels_.size());
+        info.maxLength = static_cast<std::uint8_t>(catalog[t].maxSegmentLength());
+        for (const Orientation& o : catalog[t].orientations()) {
+            kernels_.push_back({ static_cast<std::uint16_t>(segments_.size()), o.segmentCount, o.width, o.height });
+            segments_.insert(segments_.end(), o.segments.begin(), o.segments.begin() + o.segmentCount);
+            info.maxHeight = std::max(info.maxHeight, o.height);
+            ++info.count;
+        }
+    }
+}
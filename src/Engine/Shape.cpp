@@ -0,0 +1,98 @@
+/**
+* @file Shape.cpp
+ * @brief Implémentation de ShapeSet — précalcul des orientations distinctes d’une tuile.
+ */
+
+#include "../../include/Engine/Shape.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Énumère les 8 transformations (miroir × rotations) et conserve les formes distinctes.
+ *
+ * Chaque transformation est obtenue via `Tile::footprint(0, 0, r, f)`, qui renvoie des points
+ * normalisés et triés : deux orientations identiques ont donc exactement les mêmes points.
+ * Chaque ligne d’une orientation retenue est découpée en segments (suites de cases contiguës).
+ *
+ * @param tile Tuile source.
+ */
+ShapeSet::ShapeSet(const Tile& tile) : tileId_(tile.getId()) {
+    canonical_.fill(-1);
+    std::vector<std::vector<std::pair<int,int>>> seen;
+
+    for (int f = 0; f < 2; ++f) {
+        for (int r = 0; r < 4; ++r) {
+            auto pts = tile.footprint(0, 0, r, f == 1);
+            if (pts.empty()) throw std::invalid_argument("ShapeSet: empty tile " + tileId_);
+
+            int found = -1;
+            for (std::size_t i = 0; i < seen.size(); ++i) {
+                if (seen[i] == pts) { found = static_cast<int>(i); break; }
+            }
+            if (found >= 0) {
+                canonical_[f * 4 + r] = static_cast<std::int8_t>(found);
+                continue;
+            }
+
+            Orientation o;
+            o.rotations = static_cast<std::uint8_t>(r);
+            o.flipped = (f == 1);
+            int w = 0, h = 0;
+            for (auto [x, y] : pts) {
+                if (x >= kMaxShapeSide || y >= kMaxShapeSide)
+                    throw std::invalid_argument("ShapeSet: tile too large " + tileId_);
+                o.cells[o.cellCount++] = { static_cast<std::uint8_t>(x), static_cast<std::uint8_t>(y) };
+                o.rows[y] |= Row(1) << x;
+                w = std::max(w, x + 1);
+                h = std::max(h, y + 1);
+            }
+            o.width = static_cast<std::uint8_t>(w);
+            o.height = static_cast<std::uint8_t>(h);
+            for (int dy = 0; dy < h; ++dy) {
+                for (Row bits = o.rows[dy]; bits;) {
+                    const int dx = lowestBit(bits);
+                    int length = 0;
+                    while ((bits >> (dx + length)) & 1u) ++length;
+                    bits &= ~(columnsMask(length) << dx);
+                    o.segments[o.segmentCount++] = { static_cast<std::uint8_t>(dy), static_cast<std::uint8_t>(dx),
+                                                     static_cast<std::uint8_t>(length) };
+                    maxSegmentLength_ = std::max(maxSegmentLength_, length);
+                }
+            }
+
+            canonical_[f * 4 + r] = static_cast<std::int8_t>(orientations_.size());
+            orientations_.push_back(o);
+            seen.push_back(std::move(pts));
+        }
+    }
+}
+
+/**
+ * @brief Retrouve l’orientation équivalente à une transformation donnée.
+ * @param rotations Nombre de rotations (quelconque, ramené à 0..3).
+ * @param flipped Miroir.
+ * @return Indice dans orientations(), -1 si aucune orientation.
+ */
+int ShapeSet::indexOf(int rotations, bool flipped) const {
+    rotations = ((rotations % 4) + 4) % 4;
+    return canonical_[(flipped ? 4 : 0) + rotations];
+}
+
+/**
+ * @brief Compare les formes à rotation / miroir près.
+ *
+ * Les orientations étant normalisées et leurs cases triées, il suffit de chercher
+ * la première orientation de cette forme parmi celles de `other`.
+ *
+ * @param other Autre ensemble d’orientations.
+ * @return true si les deux tuiles sont superposables.
+ */
+bool ShapeSet::sameShape(const ShapeSet& other) const {
+    if (orientations_.empty() || other.orientations_.empty()) return false;
+    const Orientation& a = orientations_.front();
+    for (const auto& b : other.orientations_) {
+        if (a.cellCount != b.cellCount || a.width != b.width || a.height != b.height) continue;
+        if (std::equal(a.cells.begin(), a.cells.begin() + a.cellCount, b.cells.begin())) return true;
+    }
+    return false;
+}
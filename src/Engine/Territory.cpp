@@ -0,0 +1,91 @@
+/**
+* @file Territory.cpp
+ * @brief Implémentation de Territory — Voronoï par parcours en largeur sur masques de bits.
+ */
+
+#include "../../include/Engine/Territory.hpp"
+#include <algorithm>
+
+/**
+ * @brief Les fronts partent des territoires. À chaque pas, `reached` marque les cases
+ *        atteintes par au moins un siège et `twice` par au moins deux ; les cases
+ *        infranchissables pour tous sont marquées visitées dès le départ. Chaque front ne
+ *        dilate que sa bande de lignes [lo, hi] élargie d’une ligne ; un front vide
+ *        (lo > hi) n’est plus parcouru.
+ */
+Territory Territory::compute(const Position& position) {
+    Territory t;
+    const int rows = position.rows(), cols = position.cols(), seats = position.numSeats();
+    const Row colMask = columnsMask(cols);
+
+    std::array<BitGrid, kMaxPlayers> frontier{}, passable{};
+    std::array<int, kMaxPlayers> lo{}, hi{};
+    BitGrid visited{};
+    for (int s = 0; s < seats; ++s) {
+        frontier[s] = position.owned(s);
+        const PlacementMasks masks = position.masks(s);
+        lo[s] = rows;
+        hi[s] = -1;
+        for (int y = 0; y < rows; ++y) {
+            passable[s][y] = masks.free[y];
+            if (frontier[s][y]) {
+                lo[s] = std::min(lo[s], y);
+                hi[s] = y;
+            }
+        }
+    }
+    for (int y = 0; y < rows; ++y) {
+        Row any = 0;
+        for (int s = 0; s < seats; ++s) any |= passable[s][y];
+        visited[y] = ~any;
+    }
+
+    while (true) {
+        std::array<BitGrid, kMaxPlayers> next{};
+        BitGrid reached{}, twice{};
+        Row anyRow = 0;
+        for (int s = 0; s < seats; ++s) {
+            if (lo[s] > hi[s]) continue;
+            const BitGrid& f = frontier[s];
+            const int y0 = std::max(0, lo[s] - 1), y1 = std::min(rows - 1, hi[s] + 1);
+            for (int y = y0; y <= y1; ++y) {
+                Row grown = f[y] | (f[y] << 1) | (f[y] >> 1);
+                if (y > 0) grown |= f[y - 1];
+                if (y + 1 < rows) grown |= f[y + 1];
+                const Row n = grown & colMask & passable[s][y] & ~visited[y];
+                next[s][y] = n;
+                twice[y] |= reached[y] & n;
+                reached[y] |= n;
+                anyRow |= n;
+            }
+        }
+        if (!anyRow) break;
+        ++t.steps;
+        for (int y = 0; y < rows; ++y) {
+            visited[y] |= reached[y];
+            t.contested[y] |= twice[y];
+        }
+        for (int s = 0; s < seats; ++s) {
+            if (lo[s] > hi[s]) continue;
+            const int y0 = std::max(0, lo[s] - 1), y1 = std::min(rows - 1, hi[s] + 1);
+            lo[s] = rows;
+            hi[s] = -1;
+            for (int y = y0; y <= y1; ++y) {
+                if (const Row shared = next[s][y] & twice[y]) {
+                    t.contestedArea[s] += popCount(shared);
+                    next[s][y] &= ~shared;
+                }
+                if (next[s][y]) {
+                    t.region[s][y] |= next[s][y];
+                    lo[s] = std::min(lo[s], y);
+                    hi[s] = y;
+                }
+            }
+            frontier[s] = next[s];
+        }
+    }
+    for (int s = 0; s < seats; ++s)
+        for (int y = 0; y < rows; ++y)
+            if (t.region[s][y]) t.area[s] += popCount(t.region[s][y]);
+    return t;
+}
@@ -0,0 +1,120 @@
+/**
+* @file TileBag.cpp
+ * @brief Implémentation de TileBag — vue publique de la pioche pour la simulation.
+ */
+
+#include "../../include/Engine/TileBag.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Fenêtre lue par nextTileIds(), composition cachée = restants moins la fenêtre.
+ */
+TileBag TileBag::fromQueue(const TileQueue& queue, const std::vector<double>& weights, int window) {
+    if (queue.shapeCount() > static_cast<std::size_t>(kMaxCatalog))
+        throw std::length_error("TileBag: catalog larger than kMaxCatalog");
+
+    TileBag bag;
+    bag.catalogSize_ = static_cast<std::int16_t>(queue.shapeCount());
+    bag.mode_ = queue.samplingMode();
+    bag.weights_ = &weights;
+
+    for (int i = 0; i < bag.catalogSize_; ++i) {
+        bag.hidden_[i] = static_cast<std::uint16_t>(queue.remainingOfShape(static_cast<std::size_t>(i)));
+        bag.full_[i] = bag.weight_(i) > 0.0 ? 1 : 0;
+    }
+    if (window > kMaxKnownTiles) window = kMaxKnownTiles;
+    for (const auto& id : queue.nextTileIds(static_cast<std::size_t>(window))) {
+        auto idx = queue.shapeIndex(id);
+        if (!idx) continue;
+        bag.known_[bag.knownCount_++] = static_cast<std::uint8_t>(*idx);
+        if (bag.hidden_[*idx] > 0) --bag.hidden_[*idx];
+    }
+    if (bag.mode_ == TileQueue::SamplingMode::WeightedWithReplacement) bag.hidden_.fill(0);
+    return bag;
+}
+
+int TileBag::exchange(int i, int current) {
+    std::uint8_t& slot = known_[knownHead_ + i];
+    const int previous = slot;
+    slot = static_cast<std::uint8_t>(current);
+    return previous;
+}
+
+double TileBag::weight_(int tile) const {
+    if (mode_ == TileQueue::SamplingMode::Shuffle) return 1.0;
+    if (!weights_ || tile >= static_cast<int>(weights_->size())) return 1.0;
+    return (*weights_)[tile];
+}
+
+/**
+ * @brief Parcours linéaire du catalogue (une centaine de tuiles).
+ *
+ * Sans remise : probabilité ∝ exemplaires restants × poids (ordre pondéré de la vraie pioche),
+ * la composition étant reconstituée quand plus rien ne reste. Avec remise : ∝ poids.
+ */
+int TileBag::sampleHidden_(double u) {
+    const bool replace = mode_ == TileQueue::SamplingMode::WeightedWithReplacement;
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        double total = 0.0;
+        for (int i = 0; i < catalogSize_; ++i)
+            total += (replace ? 1.0 : double(hidden_[i])) * weight_(i);
+        if (total <= 0.0) {
+            hidden_ = full_;
+            continue;
+        }
+        double r = u * total;
+        int last = -1;
+        for (int i = 0; i < catalogSize_; ++i) {
+            const double w = (replace ? 1.0 : double(hidden_[i])) * weight_(i);
+            if (w <= 0.0) continue;
+            last = i;
+            if (r < w) break;
+            r -= w;
+        }
+        if (!replace) --hidden_[last];
+        return last;
+    }
+    return 0;
+}
+
+int TileBag::fillDeck_() {
+    if (mode_ == TileQueue::SamplingMode::WeightedWithReplacement) return -1;
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        int n = 0;
+        for (int i = 0; i < catalogSize_; ++i) {
+            if (hidden_[i] == 0 || weight_(i) <= 0.0) continue;
+            if (n + hidden_[i] > kMaxCatalog) return -1;
+            for (int c = 0; c < hidden_[i]; ++c) deck_[n++] = static_cast<std::uint8_t>(i);
+        }
+        if (n > 0 || attempt > 0) {
+            deckHead_ = 0;
+            deckCount_ = static_cast<std::int16_t>(n);
+            return n;
+        }
+        hidden_ = full_;
+    }
+    return -1;
+}
+
+/**
+ * @brief Mode Shuffle : Fisher-Yates. Mode WeightedShuffle : clés exponentielles −ln(1−u)/poids
+ *        triées par ordre croissant, ce qui équivaut à des tirages successifs pondérés sans remise.
+ */
+void TileBag::orderDeck_(const double* u) {
+    const int n = deckCount_;
+    if (mode_ == TileQueue::SamplingMode::Shuffle) {
+        for (int i = n - 1; i > 0; --i) {
+            const int j = std::min(i, static_cast<int>(u[i] * (i + 1)));
+            std::swap(deck_[i], deck_[j]);
+        }
+        return;
+    }
+    std::array<std::pair<double, std::uint8_t>, kMaxCatalog> keyed;
+    for (int i = 0; i < n; ++i) keyed[i] = {-std::log1p(-u[i]) / weight_(deck_[i]), deck_[i]};
+    std::sort(keyed.begin(), keyed.begin() + n,
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    for (int i = 0; i < n; ++i) deck_[i] = keyed[i].second;
+}
@@ -0,0 +1,76 @@
+/**
+* @file Zobrist.cpp
+ * @brief Implémentation de Zobrist — clés de hachage des positions.
+ */
+
+#include "../../include/Engine/Zobrist.hpp"
+#include <algorithm>
+
+namespace {
+
+/**
+ * @brief Générateur SplitMix64 (suite fixe, bien mélangée).
+ */
+std::uint64_t splitMix64(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+} // namespace
+
+const Zobrist& Zobrist::instance() {
+    static const Zobrist keys;
+    return keys;
+}
+
+Zobrist::Zobrist() {
+    std::uint64_t state = 0x2CC9'2025ull;
+    for (auto& seat : cells_)
+        for (auto& k : seat) k = splitMix64(state);
+    for (auto& k : stones_) k = splitMix64(state);
+    for (auto& k : toMove_) k = splitMix64(state);
+    for (auto& k : round_) k = splitMix64(state);
+    for (auto& k : hand_) k = splitMix64(state);
+    for (auto& seat : coupons_)
+        for (auto& k : seat) k = splitMix64(state);
+    for (auto& k : rock_) k = splitMix64(state);
+    for (auto& slot : window_)
+        for (auto& k : slot) k = splitMix64(state);
+    for (auto& k : perspective_) k = splitMix64(state);
+}
+
+std::uint64_t Zobrist::board(const Position& pos) const {
+    std::uint64_t key = 0;
+    const Row cm = columnsMask(pos.cols());
+    for (int y = 0; y < pos.rows(); ++y) {
+        Row stones = ~pos.empty()[y] & cm;
+        for (int s = 0; s < pos.numSeats(); ++s) {
+            stones &= ~pos.owned(s)[y];
+            for (Row r = pos.owned(s)[y]; r; r &= r - 1) key ^= cell(s, lowestBit(r), y);
+        }
+        for (Row r = stones; r; r &= r - 1) key ^= stone(lowestBit(r), y);
+    }
+    return key;
+}
+
+/**
+ * @brief Les coupons au-delà de 3 partagent la même clé (ils ne changent plus le jeu
+ *        à l’horizon d’une recherche).
+ */
+std::uint64_t Zobrist::turnKey(const Position& pos, int tile) const {
+    std::uint64_t key = toMove_[pos.toMove()] ^ round_[std::min(pos.round(), kMaxRounds + 1)]
+                      ^ hand_[tile < 0 ? kMaxCatalog : tile];
+    for (int s = 0; s < pos.numSeats(); ++s) {
+        key ^= coupons_[s][std::min(pos.coupons(s), 3)];
+        if (pos.rockPending(s)) key ^= rock_[s];
+    }
+    return key;
+}
+
+std::uint64_t Zobrist::windowKey(const TileBag& bag) const {
+    std::uint64_t key = 0;
+    for (int i = 0; i < bag.knownCount(); ++i) key ^= window_[i][bag.known(i)];
+    return key;
+}
@@ -16,10 +16,24 @@ static void enableAnsiOnWindows() {}
 
 #include "../../include/Game/Game.hpp"
 #include "../../include/Render/Renderer.hpp"
+#include "../../include/Engine/Coverage.hpp"
+#include "../../include/Engine/MoveGenerator.hpp"
+#include "../../include/Engine/Territory.hpp"
+#include "../../include/Engine/TileBag.hpp"
+#include "../../include/AI/AlphaBetaAgent.hpp"
+#include "../../include/AI/ExchangeAdvisor.hpp"
+#include "../../include/AI/FinalCellSolver.hpp"
+#include "../../include/AI/HeuristicAgent.hpp"
+#include "../../include/AI/MctsAgent.hpp"
+#include "../../include/AI/StoneAdvisor.hpp"
+#include <array>
 #include <iostream>
+#include <iomanip>
+#include <sstream>
 #include <algorithm>
 #include <cctype>
 #include <limits>
+#include <thread>
 //fix
 /* ---------------------- HELPERS ---------------------- */
 
@@ -61,7 +75,8 @@ Game::Game()
       queue(true),
       currentRound(1),
       currentPlayerIndex(0),
-      gameOver(false) {}
+      gameOver(false),
+      originHints(false) {}
 
 Game::~Game() {
     delete display;
@@ -88,6 +103,19 @@ void Game::start() {
 
 void Game::setupPlayers() {
     int numberOfPlayers = readIntInRangeStrict("How many players will play (2 to 9) ? : ", 2, 9);
+    int numberOfBots = readIntInRangeStrict("How many of them are computer players (0 to "
+                                            + std::to_string(numberOfPlayers) + ") ? : ", 0, numberOfPlayers);
+    // 1 : MCTS, 2 à 5 : les politiques de HeuristicPolicy dans l’ordre de Kind, 6 : alpha-bêta.
+    int botType = 1;
+    if (numberOfBots > 0) {
+        botType = readIntInRangeStrict("Computer players : 1 = MCTS, 2 = random, 3 = greedy square, "
+                                       "4 = bonus seeker, 5 = blocker, 6 = alpha-beta : ", 1, 6);
+    }
+    // Poids réglés par l’outil tune (copiés dans le dossier de build) ; poids par défaut sinon.
+    AlphaBetaAgent::Config alphaBeta;
+    if (botType == 6 && alphaBeta.weights.load("weights.json")) {
+        std::cout << "Evaluation weights loaded from weights.json\n";
+    }
 
     std::vector<std::string> availableColors = {
         "red", "blue", "green", "yellow",
@@ -96,8 +124,9 @@ void Game::setupPlayers() {
 
     players.clear();
     players.reserve(numberOfPlayers);
+    bots.clear();
 
-    for (int i = 0; i < numberOfPlayers; ++i) {
+    for (int i = 0; i < numberOfPlayers - numberOfBots; ++i) {
         std::string name;
         std::string color;
         bool validColor = false;
@@ -129,6 +158,37 @@ void Game::setupPlayers() {
         std::cout << "Player : " << name << " saved along with its color : " << color << " !\n";
     }
 
+    for (int i = 0; i < numberOfBots; ++i) {
+        const std::string name = "Bot " + std::to_string(i + 1);
+        const std::string color = availableColors.front();
+        availableColors.erase(availableColors.begin());
+        players.emplace_back(name, color);
+        if (botType == 1) {
+            MctsAgent::Config config;
+            config.threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+            bots[players.back().getID()] = std::make_unique<MctsAgent>(config);
+        } else if (botType == 6) {
+            bots[players.back().getID()] = std::make_unique<AlphaBetaAgent>(alphaBeta);
+        } else {
+            HeuristicAgent::Config config;
+            config.kind = static_cast<HeuristicPolicy::Kind>(botType - 2);
+            bots[players.back().getID()] = std::make_unique<HeuristicAgent>(config);
+        }
+        std::cout << "Computer player : " << name << " saved along with its color : " << color << " !\n";
+    }
+
+    ponderer.reset();
+    if (numberOfBots < numberOfPlayers
+        && readYesNo("Analyse the game in the background while you think (hints with 'h') ? (y/n) : ")) {
+        ponderer = std::make_unique<Ponderer>();
+    }
+
+    // Livre d’ouvertures (outil book, copié dans le dossier de build) : bots et conseils de départ.
+    if ((numberOfBots > 0 || ponderer) && openingBook.open("openings.book")) {
+        std::cout << "Opening book loaded from openings.book (" << openingBook.size() << " positions)\n";
+        for (auto& [id, agent] : bots) agent->setOpeningBook(&openingBook);
+    }
+
     std::random_device rd; std::mt19937 g(rd());
     std::shuffle(players.begin(), players.end(), g);
     announceOrder();
@@ -153,18 +213,59 @@ void Game::setupTiles() {
         std::cerr << "Error : cannot load Shapes.kson\n";
         std::exit(1);
     }
-    queue.initFrom(tileSet, /*shuffle=*/true);
+    // Ordre pondéré par les poids du catalogue (identique au mélange uniforme si tous valent 1).
+    queue.setSamplingMode(TileQueue::SamplingMode::WeightedShuffle);
+    if (!queue.initFrom(tileSet, /*shuffle=*/true)) {
+        std::cerr << "Error : no drawable tile in Shapes.json (all weights are zero)\n";
+        std::exit(1);
+    }
     std::cout << "\n";
 
+    catalogShapes.clear();
+    for (const auto& tile : tileSet.all()) catalogShapes.emplace_back(tile);
+
+    drawableShapes.clear();
+    const auto& weights = tileSet.weights();
+    for (std::size_t i = 0; i < tileSet.all().size(); ++i) {
+        if (i < weights.size() && weights[i] <= 0.0) continue;
+        ShapeSet shape(tileSet.all()[i]);
+        bool duplicate = false;
+        for (const auto& known : drawableShapes) {
+            if (known.sameShape(shape)) { duplicate = true; break; }
+        }
+        if (!duplicate) drawableShapes.push_back(std::move(shape));
+    }
+    std::stable_sort(drawableShapes.begin(), drawableShapes.end(),
+                     [](const ShapeSet& a, const ShapeSet& b) { return a.cellCount() < b.cellCount(); });
+    catalogCoverage = Coverage(drawableShapes);
+    tileCoverage.clear();
+
     auto ids = queue.nextTileIds(5);
     std::cout << "\n";
 }
 
 void Game::placeStartingTiles() {
-    for (auto& player : players) {
+    for (std::size_t seat = 0; seat < players.size(); ++seat) {
+        Player& player = players[seat];
+        if (Agent* agent = botFor(player)) {
+            const Position position = snapshot(static_cast<int>(seat));
+            auto [col, row] = agent->chooseStart(position, static_cast<int>(seat));
+            // Aucune case candidate : première case vide hors bonus.
+            for (int y = 0; col < 0 && y < position.rows(); ++y)
+                for (int x = 0; col < 0 && x < position.cols(); ++x)
+                    if (position.isEmpty(x, y) && !position.isBonus(x, y)) { col = x; row = y; }
+            if (col < 0) {
+                std::cout << player.getName() << " has no free cell for its starting tile.\n";
+                continue;
+            }
+            board.placeTile(col, row, player.getID());
+            std::cout << player.getName() << " places its starting tile in " << colToLetters(col) << row << "\n";
+            continue;
+        }
         bool placed = false;
         while (!placed) {
             displayBoard();
+            if (ponderer) showBookMoves(static_cast<int>(seat));
             std::cout << player.getName() << " (" << player.getColor()
                       << "), enter your starting tile position (e.g., A0):\n";
 
@@ -179,10 +280,7 @@ void Game::placeStartingTiles() {
                 continue;
             }
 
-            auto& grid  = const_cast<std::vector<std::vector<char>>&>(board.getGrid());
-            auto& owner = const_cast<std::vector<std::vector<int>>&>(board.getOwnerGrid());
-            grid[row][col]  = '#';
-            owner[row][col] = player.getID();
+            board.placeTile(col, row, player.getID());
 
             std::cout << "Tile placed in " << colToLetters(col) << row << "\n\n";
             placed = true;
@@ -192,6 +290,21 @@ void Game::placeStartingTiles() {
     displayBoard();
 }
 
+void Game::showBookMoves(int seat) const {
+    std::array<BookMove, kBookMoves> moves;
+    const Position position = snapshot(seat);
+    const int n = openingBook.lookup(position, seat, moves);
+    std::string line;
+    for (int i = 0; i < n; ++i) {
+        if (!position.isEmpty(moves[i].x, moves[i].y) || position.isBonus(moves[i].x, moves[i].y)) continue;
+        std::ostringstream os;
+        os << colToLetters(moves[i].x) << static_cast<int>(moves[i].y) << " (" << std::fixed << std::setprecision(0)
+           << 100.0 * moves[i].share() << "%)";
+        line += (line.empty() ? "" : ", ") + os.str();
+    }
+    if (!line.empty()) std::cout << "Opening book : " << line << "\n";
+}
+
 Player& Game::getPlayerById(int id) {
     for (auto& player : players) {
         if (player.getID() == id)
@@ -230,6 +343,11 @@ void Game::playTurn(Player& player) {
     std::cout << "Stealth bonus : "
               << (player.hasStealthBonus() ? "available" : "none") << "\n";
 
+    if (botFor(player)) {
+        playBotTurn(player);
+        return;
+    }
+
     if (player.hasRockBonus()) {
         std::cout << "\n*** ROCK BONUS ***\n";
         std::cout << player.getName()
@@ -248,25 +366,34 @@ void Game::playTurn(Player& player) {
     }
 
     Tile current = queue.draw();
-    showQueueWithCurrent(current);
+    auto showCurrent = [&]() {
+        showQueueWithCurrent(current);
+        if (originHints) showOrigins(current);
+    };
+    showCurrent();
+    startPondering(current);
 
     while (true) {
-        char cmd = readChoice(
-            "Actions : p = place, e = exchange, r = rotate, f = flip, q = cancel : ",
-            "perfq"
-        );
+        char cmd = ponderer
+            ? readChoice("Actions : p = place, e = exchange, r = rotate, f = flip, o = origins on/off, h = hint, t = territory, c = coverage, q = cancel : ", "perfohtcq")
+            : readChoice("Actions : p = place, e = exchange, r = rotate, f = flip, o = origins on/off, t = territory, c = coverage, q = cancel : ", "perfotcq");
 
         if (cmd == 'r') {
             current.rotate();
-            showQueueWithCurrent(current);
+            showCurrent();
         } else if (cmd == 'f') {
             current.flip();
-            showQueueWithCurrent(current);
+            showCurrent();
+        } else if (cmd == 'o') {
+            originHints = !originHints;
+            if (originHints) showOrigins(current);
+            else std::cout << "Origin hints off.\n";
         } else if (cmd == 'e') {
             if (player.getExchangeCoupons() > 0) {
                 if (promptExchange(current)) {
                     player.useExchangeCoupon();
-                    showQueueWithCurrent(current);
+                    showCurrent();
+                    startPondering(current);
                 }
             } else {
                 std::cout << "You have no more exchange tickets !\n";
@@ -277,23 +404,237 @@ void Game::playTurn(Player& player) {
                 break;
             } else {
                 std::cout << "Invalid or cancelled placement.\n";
-                showQueueWithCurrent(current);
+                showCurrent();
             }
+        } else if (cmd == 'h') {
+            showHints();
+        } else if (cmd == 't') {
+            showTerritory();
+        } else if (cmd == 'c') {
+            showCoverage(current);
         } else if (cmd == 'q') {
             std::cout << "Placement cancelled. Tile lost for this round.\n";
             break;
         }
     }
+    if (ponderer) ponderer->stop();
+}
+
+void Game::playBotTurn(Player& player) {
+    Agent& agent = *botFor(player);
+    const int seat = currentPlayerIndex;
+
+    if (player.hasRockBonus()) {
+        auto cell = agent.chooseStone(snapshot(seat), seat);
+        if (cell && board.placeStone(cell->first, cell->second)) {
+            std::cout << player.getName() << " places a stone at "
+                      << colToLetters(cell->first) << cell->second << ".\n";
+        } else {
+            std::cout << "Rock bonus could not be used. Bonus lost.\n";
+        }
+        player.setRockBonusAvailable(false);
+    }
+
+    Tile current = queue.draw();
+    showQueueWithCurrent(current);
+
+    const auto tileIndex = queue.shapeIndex(current.getId());
+    if (!tileIndex) {
+        std::cout << player.getName() << " cannot use this tile. Tile lost for this round.\n";
+        return;
+    }
+    const Position position = snapshot(seat);
+    const TileBag bag = TileBag::fromQueue(queue, queue.weights());
+    std::optional<Ponderer::Prepared> prepared;
+    if (ponderer) prepared = ponderer->take(position, bag, static_cast<int>(*tileIndex));
+    const TurnDecision decision = prepared
+        ? prepared->decision
+        : agent.decideTurn({position, bag, catalogShapes, static_cast<int>(*tileIndex)});
+
+    int placedTile = static_cast<int>(*tileIndex);
+    if (decision.exchangeSlot >= 0 && player.getExchangeCoupons() > 0) {
+        auto newTile = queue.exchangeWithWindow(static_cast<std::size_t>(decision.exchangeSlot), current.getId());
+        if (newTile) {
+            current = *newTile;
+            player.useExchangeCoupon();
+            const auto newIndex = queue.shapeIndex(newTile->getId());
+            placedTile = newIndex ? static_cast<int>(*newIndex) : -1;
+            std::cout << player.getName() << " exchanges its tile with preview tile "
+                      << (decision.exchangeSlot + 1) << ".\n";
+        }
+    }
+
+    const std::string report = prepared ? prepared->report : agent.lastReport();
+    if (!report.empty()) std::cout << report << (prepared ? " (prepared during the previous turn)" : "") << "\n";
+    if (!prepared && agent.lastBudget().budget > 0.0) {
+        const BudgetUsage& usage = agent.lastBudget();
+        std::cout << std::fixed << std::setprecision(2) << "Time used : " << usage.used << " s of "
+                  << usage.budget << " s (" << std::setprecision(0) << 100.0 * usage.used / usage.budget << "%)" << std::defaultfloat << "\n";
+    }
+
+    if (decision.pass || decision.tile != placedTile) {
+        std::cout << player.getName() << " cannot place its tile. Tile lost for this round.\n";
+        return;
+    }
+    const ShapeSet& shape = catalogShapes[placedTile];
+    auto pts = MoveGenerator::footprint(shape, decision.move);
+    if (!canPlaceFootprint(pts, player.getID())) {
+        std::cout << player.getName() << " chose an invalid placement. Tile lost for this round.\n";
+        return;
+    }
+    placeFootprint(pts, player.getID());
+    const Orientation& o = shape.orientations()[decision.move.orientation];
+    std::cout << player.getName() << " places its tile at " << colToLetters(decision.move.x) << int(decision.move.y)
+              << " (rotation " << int(o.rotations) << (o.flipped ? ", flipped" : "") << ").\n";
+    displayBoard();
+}
+
+void Game::startPondering(const Tile& current) {
+    if (!ponderer) return;
+    const auto tileIndex = queue.shapeIndex(current.getId());
+    if (!tileIndex) {
+        ponderer->stop();
+        return;
+    }
+    const int seat = currentPlayerIndex;
+    const Position position = snapshot(seat);
+    const TileBag bag = TileBag::fromQueue(queue, queue.weights());
+    Agent* nextBot = botFor(players[(seat + 1) % players.size()]);
+    ponderer->start({position, bag, catalogShapes, static_cast<int>(*tileIndex)}, nextBot);
+}
+
+void Game::showHints() const {
+    const auto hints = ponderer->hints(3);
+    if (hints.empty()) {
+        std::cout << "No hint available yet.\n";
+        return;
+    }
+    std::cout << "Hints :\n";
+    for (std::size_t i = 0; i < hints.size(); ++i) {
+        const auto& h = hints[i];
+        const Orientation& o = catalogShapes[h.tile].orientations()[h.move.orientation];
+        std::cout << "  " << (i + 1) << ". ";
+        if (h.exchangeSlot >= 0) std::cout << "exchange with preview tile " << (h.exchangeSlot + 1) << ", then ";
+        std::cout << "place at " << colToLetters(h.move.x) << int(h.move.y)
+                  << " (rotation " << int(o.rotations) << (o.flipped ? ", flipped" : "") << "), expected result "
+                  << std::fixed << std::setprecision(2) << h.value << std::defaultfloat << "\n";
+    }
+}
+
+void Game::showTerritory() const {
+    if (!display) return;
+    const Territory territory = Territory::compute(snapshot(currentPlayerIndex));
+    Display_Board::Overlay overlay;
+    overlay.marks.assign(board.getRows(), std::vector<char>(board.getCols(), '\0'));
+    overlay.seats.assign(board.getRows(), std::vector<int>(board.getCols(), -1));
+    for (int y = 0; y < board.getRows(); ++y) {
+        for (int x = 0; x < board.getCols(); ++x) {
+            if ((territory.contested[y] >> x) & 1u) {
+                overlay.marks[y][x] = '?';
+                continue;
+            }
+            for (std::size_t s = 0; s < players.size(); ++s) {
+                if ((territory.region[s][y] >> x) & 1u) {
+                    overlay.marks[y][x] = '+';
+                    overlay.seats[y][x] = static_cast<int>(s);
+                }
+            }
+        }
+    }
+    display->display(*this, overlay);
+    std::cout << "Territory (empty cells reached first) :\n";
+    for (std::size_t s = 0; s < players.size(); ++s) {
+        std::cout << "  " << players[s].getName() << " : " << territory.area[s]
+                  << " (+" << territory.contestedArea[s] << " contested)\n";
+    }
+}
+
+void Game::showCoverage(const Tile& current) const {
+    if (!display) return;
+    const int seat = currentPlayerIndex;
+    const Position position = snapshot(seat);
+    auto it = tileCoverage.find(current.getId());
+    if (it == tileCoverage.end())
+        it = tileCoverage.emplace(current.getId(), Coverage({ShapeSet(current)})).first;
+    Coverage& coverage = it->second;
+    coverage.update(position);
+    const auto counts = coverage.grid(seat);
+    const Coverage::Features features = coverage.features(seat);
+    if (features.maxCoverage == 0) {
+        std::cout << "This tile cannot be placed anywhere.\n";
+        return;
+    }
+    Display_Board::Overlay overlay;
+    overlay.marks.assign(board.getRows(), std::vector<char>(board.getCols(), '\0'));
+    overlay.seats.assign(board.getRows(), std::vector<int>(board.getCols(), seat));
+    for (int y = 0; y < board.getRows(); ++y) {
+        for (int x = 0; x < board.getCols(); ++x) {
+            if (counts[y][x] == 0) continue;
+            overlay.marks[y][x] = static_cast<char>('1' + (counts[y][x] * 9 - 1) / (features.maxCoverage + 1));
+        }
+    }
+    display->display(*this, overlay);
+    std::cout << "Coverage : " << features.coveredCells << " cells reachable by this tile, up to "
+              << features.maxCoverage << " placements on one cell.\n";
+    catalogCoverage.update(position);
+    const Coverage::Features reach = catalogCoverage.features(seat);
+    std::cout << "Any tile : " << reach.coveredCells << " cells reachable, "
+              << reach.exclusiveCells << " of them by no opponent.\n";
+}
+
+void Game::showOrigins(const Tile& current) const {
+    if (!display) return;
+    const int seat = currentPlayerIndex;
+    const ShapeSet shape(current);
+    const BitGrid legal = MoveGenerator::legalOrigins(MoveGenerator::masksFor(board, players[seat].getID()),
+                                                      shape.orientations()[shape.indexOf(0, false)]);
+    Display_Board::Overlay overlay;
+    overlay.marks.assign(board.getRows(), std::vector<char>(board.getCols(), '\0'));
+    overlay.seats.assign(board.getRows(), std::vector<int>(board.getCols(), seat));
+    int count = 0;
+    for (int y = 0; y < board.getRows(); ++y) {
+        for (Row r = legal[y]; r; r &= r - 1) {
+            overlay.marks[y][lowestBit(r)] = 'o';
+            ++count;
+        }
+    }
+    display->display(*this, overlay);
+    if (count == 0) std::cout << "No legal origin in this orientation : rotate, flip or exchange.\n";
+    else std::cout << count << " legal origins ('o') in this orientation.\n";
+}
+
+Agent* Game::botFor(const Player& player) const {
+    auto it = bots.find(player.getID());
+    return it == bots.end() ? nullptr : it->second.get();
+}
+
+Position Game::snapshot(int seat) const {
+    return Position::fromBoard(board, players, currentRound, seat);
 }
 
 void Game::endRound() {
     if (isGameOver()) {
+        std::cout << "\nNo player can place a tile anymore : the game ends after round "
+                  << currentRound << ".\n";
         gameOver = true;
     }
 }
 
 bool Game::isGameOver() const {
-    return false;
+    return isSaturated(board, players, drawableShapes);
+}
+
+bool Game::isSaturated(const Board& board, const std::vector<Player>& players,
+                       const std::vector<ShapeSet>& shapes) {
+    if (shapes.empty()) return false;
+    for (const auto& p : players) {
+        if (board.anchorCount(p.getID()) == 0) continue;
+        const PlacementMasks masks = MoveGenerator::masksFor(board, p.getID());
+        for (const auto& shape : shapes) {
+            if (MoveGenerator::hasAnyMove(masks, shape)) return false;
+        }
+    }
+    return true;
 }
 
 /* ---------------------- ACTIONS TUILE ---------------------- */
@@ -305,6 +646,7 @@ void Game::showQueueWithCurrent(const Tile& current) const {
 
 bool Game::promptExchange(Tile& current) {
     auto ids = queue.nextTileIds(5);
+    showExchangeAdvice(current);
 
     int index = readIntInRange("Choose the tile you want to exchange with your current one (1 to 5) : ", 1, 5);
 
@@ -317,6 +659,29 @@ bool Game::promptExchange(Tile& current) {
     return true;
 }
 
+void Game::showExchangeAdvice(const Tile& current) const {
+    const auto tileIndex = queue.shapeIndex(current.getId());
+    if (!tileIndex) return;
+    const Position position = snapshot(currentPlayerIndex);
+    const TileBag bag = TileBag::fromQueue(queue, queue.weights());
+    const auto options = ExchangeAdvisor().rank({position, bag, catalogShapes, static_cast<int>(*tileIndex)});
+
+    std::cout << "Exchange advisor (best first) :\n";
+    for (const auto& option : options) {
+        std::cout << "  " << (option.slot < 0 ? "current tile    " : "preview tile " + std::to_string(option.slot + 1) + "  ")
+                  << " : " << option.placements << " placements";
+        if (option.placements > 0) {
+            std::cout << ", best square " << std::showpos << option.squareGain << ", cells " << option.cellGain
+                      << std::noshowpos;
+            if (option.bonuses > 0) std::cout << ", captures " << option.bonuses << " bonus";
+            const Orientation& o = catalogShapes[option.tile].orientations()[option.best.orientation];
+            std::cout << " at " << colToLetters(option.best.x) << int(option.best.y)
+                      << " (rotation " << int(o.rotations) << (o.flipped ? ", flipped" : "") << ")";
+        }
+        std::cout << "\n";
+    }
+}
+
 bool Game::promptPlace(Tile& current, int playerId) {
     int x=-1, y=-1;
     const std::string prompt = "Origin (example A0, B12, etc.): ";
@@ -337,6 +702,7 @@ bool Game::promptPlace(Tile& current, int playerId) {
 bool Game::useRockBonus(Player& player) {
     std::cout << player.getName()
               << " can place a 1x1 stone 'X' on any empty cell.\n";
+    showStoneAdvice();
 
     while (true) {
         int x, y;
@@ -361,6 +727,20 @@ bool Game::useRockBonus(Player& player) {
     }
 }
 
+void Game::showStoneAdvice() const {
+    const int seat = currentPlayerIndex;
+    const auto options = StoneAdvisor().rank(snapshot(seat), seat, catalogShapes, 5);
+    if (options.empty()) return;
+    std::cout << "Stone advisor (best first) :\n";
+    for (const auto& option : options) {
+        std::cout << "  " << colToLetters(option.x) << option.y << " : removes " << option.opponentPlacements
+                  << " opponent placements";
+        if (option.ownPlacements > 0) std::cout << " (" << option.ownPlacements << " of yours)";
+        if (option.squaresBlocked > 0) std::cout << ", blocks " << option.squaresBlocked << " square extensions";
+        std::cout << "\n";
+    }
+}
+
 /* ---------------------- I/O ROBUSTES ---------------------- */
 
 int Game::readIntInRange(const std::string& prompt, int minVal, int maxVal) {
@@ -555,7 +935,8 @@ void Game::placeFootprint(const std::vector<std::pair<int,int>>& pts, int player
 void Game::finalSingleCellPhase() {
     std::cout << "\n FINAL BONUS PHASE: place a 1x1 cell (cost: 1 exchange coupon) \n";
 
-    for (auto& p : players) {
+    for (std::size_t seat = 0; seat < players.size(); ++seat) {
+        Player& p = players[seat];
         displayBoard();
         std::cout << p.getName() << " (" << p.getColor() << ")\n";
 
@@ -565,7 +946,29 @@ void Game::finalSingleCellPhase() {
             continue;
         }
 
+        if (Agent* agent = botFor(p)) {
+            auto cell = agent->chooseFinalCell(snapshot(static_cast<int>(seat)), static_cast<int>(seat));
+            std::vector<std::pair<int,int>> pts;
+            if (cell) pts.push_back(*cell);
+            if (cell && canPlaceFootprint(pts, p.getID())) {
+                placeFootprint(pts, p.getID());
+                p.useExchangeCoupon();
+                std::cout << p.getName() << " places a 1x1 tile at " << colToLetters(cell->first) << cell->second
+                          << ". Remaining coupons: " << p.getExchangeCoupons() << "\n";
+            } else {
+                std::cout << "Skipped.\n";
+            }
+            continue;
+        }
+
         std::cout << "You currently have " << coupons << " exchange coupon(s).\n";
+        if (const auto best = FinalCellSolver::best(snapshot(static_cast<int>(seat)), static_cast<int>(seat))) {
+            std::cout << "Best cell : " << colToLetters(best->x) << best->y << " (largest square "
+                      << best->maxSquare - best->squareGain << " -> " << best->maxSquare << ", cells "
+                      << best->cellCount - best->cellGain << " -> " << best->cellCount << ")\n";
+        } else {
+            std::cout << "No legal cell for a 1x1 tile.\n";
+        }
 
         if (!readYesNo("Do you want to spend 1 coupon to place a 1x1 tile? (y/n): ")) {
             std::cout << "Skipped.\n";
@@ -0,0 +1,69 @@
+/**
+* @file AliasTable.cpp
+ * @brief Implémentation de AliasTable — construction de la table d’alias (méthode de Vose).
+ */
+
+#include "../../include/Tile/AliasTable.hpp"
+
+/**
+ * @brief Construit la table à partir de poids.
+ * @param weights Poids de chaque indice.
+ */
+AliasTable::AliasTable(const std::vector<double>& weights) {
+    build(weights);
+}
+
+/**
+ * @brief Construit la table d’alias en O(n).
+ *
+ * Les poids sont normalisés pour avoir une moyenne de 1, puis répartis en deux piles
+ * (« petits » < 1 et « grands » >= 1). Chaque petit est complété par un grand qui devient
+ * son alias, jusqu’à épuisement. Les colonnes restantes reçoivent une probabilité de 1.
+ *
+ * @param weights Poids de chaque indice (négatifs traités comme 0).
+ * @return true si la somme des poids est strictement positive, false sinon.
+ */
+bool AliasTable::build(const std::vector<double>& weights) {
+    const std::size_t n = weights.size();
+    total_ = 0.0;
+    for (double w : weights) if (w > 0.0) total_ += w;
+    if (n == 0 || total_ <= 0.0) {
+        prob_.clear();
+        alias_.clear();
+        total_ = 0.0;
+        return false;
+    }
+
+    prob_.assign(n, 0.0);
+    alias_.assign(n, 0);
+    std::vector<double> scaled(n);
+    std::vector<std::uint32_t> small, large;
+    small.reserve(n);
+    large.reserve(n);
+    std::uint32_t heaviest = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (weights[i] > weights[heaviest]) heaviest = static_cast<std::uint32_t>(i);
+        scaled[i] = (weights[i] > 0.0 ? weights[i] : 0.0) * static_cast<double>(n) / total_;
+        if (scaled[i] < 1.0) small.push_back(static_cast<std::uint32_t>(i));
+        else large.push_back(static_cast<std::uint32_t>(i));
+    }
+
+    while (!small.empty() && !large.empty()) {
+        std::uint32_t s = small.back(); small.pop_back();
+        std::uint32_t l = large.back(); large.pop_back();
+        prob_[s] = scaled[s];
+        alias_[s] = l;
+        scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+        if (scaled[l] < 1.0) small.push_back(l);
+        else large.push_back(l);
+    }
+    // Restes dus aux arrondis : la colonne se sélectionne elle-même,
+    // sauf pour un poids nul qui renvoie toujours vers l’indice le plus lourd.
+    for (std::uint32_t l : large) { prob_[l] = 1.0; alias_[l] = l; }
+    for (std::uint32_t s : small) {
+        bool positive = weights[s] > 0.0;
+        prob_[s] = positive ? 1.0 : 0.0;
+        alias_[s] = positive ? s : heaviest;
+    }
+    return true;
+}
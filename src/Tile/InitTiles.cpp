@@ -6,6 +6,7 @@
 #include "../../include/Tile/InitTiles.hpp"
 #include <fstream>
 #include <unordered_set>
+#include <algorithm>
 #include <nlohmann/json.hpp>
 
 using nlohmann::json;
@@ -28,12 +29,15 @@ InitTiles::InitTiles(const std::string& jsonPath) {
  * @code{.json}
  * {
  *   "tiles": [
- *     { "id": "T1", "cells": [[0,0],[1,0],[0,1]] },
+ *     { "id": "T1", "cells": [[0,0],[1,0],[0,1]], "weight": 2 },
  *     { "id": "T2", "cells": [[0,0],[1,0]] }
  *   ]
  * }
  * @endcode
  *
+ * Le champ optionnel `weight` (nombre, 1 par défaut) est conservé dans `weights_` ;
+ * les poids négatifs sont ramenés à 0.
+ *
  * @param jsonPath Chemin du fichier JSON à ouvrir.
  * @return true si le chargement s’est effectué avec succès, false sinon.
  */
@@ -43,6 +47,7 @@ bool InitTiles::loadFromFile(const std::string& jsonPath) {
     json j;
     f >> j;
     tiles_.clear();
+    weights_.clear();
     if (!j.contains("tiles") || !j["tiles"].is_array()) return false;
     for (const auto& tile : j["tiles"]) {
         if (!tile.contains("id") || !tile.contains("cells")) continue;
@@ -54,7 +59,12 @@ bool InitTiles::loadFromFile(const std::string& jsonPath) {
             int y = c[1].get<int>();
             cells.emplace_back(x,y);
         }
+        double weight = 1.0;
+        if (tile.contains("weight") && tile["weight"].is_number()) {
+            weight = std::max(0.0, tile["weight"].get<double>());
+        }
         tiles_.emplace_back(id, std::move(cells));
+        weights_.push_back(weight);
     }
     return true;
 }
@@ -68,6 +78,14 @@ const std::vector<Tile>& InitTiles::all() const {
     return tiles_;
 }
 
+/**
+ * @brief Retourne les poids de tirage des tuiles chargées.
+ * @return Référence constante vers le vecteur interne `weights_`.
+ */
+const std::vector<double>& InitTiles::weights() const {
+    return weights_;
+}
+
 /**
  * @brief Recherche une tuile spécifique à partir de son identifiant.
  * @param id Identifiant de la tuile recherchée.
@@ -88,12 +106,18 @@ std::optional<Tile> InitTiles::byId(const std::string& id) const {
  */
 void InitTiles::deduplicateByShape() {
     std::vector<Tile> unique;
-    for (const auto& t : tiles_) {
+    std::vector<double> uniqueWeights;
+    for (std::size_t i = 0; i < tiles_.size(); ++i) {
+        const auto& t = tiles_[i];
         bool already = false;
         for (const auto& u : unique) {
             if (t.shapeEquals(u)) { already = true; break; }
         }
-        if (!already) unique.push_back(t);
+        if (!already) {
+            unique.push_back(t);
+            uniqueWeights.push_back(i < weights_.size() ? weights_[i] : 1.0);
+        }
     }
     tiles_.swap(unique);
+    weights_.swap(uniqueWeights);
 }
@@ -7,6 +7,7 @@
 #include "../../include/Tile/TileQueue.hpp"
 #include <algorithm>
 #include <stdexcept>
+#include <utility>
 
 
 
@@ -21,22 +22,56 @@ TileQueue::TileQueue(bool reshuffleOnExhaustion)
 /**
  * @brief Initialise la pioche depuis un catalogue, avec mélange optionnel et graine donnée.
  *
- * Copie `src.all()` dans `all_`, initialise le RNG avec `seed`, optionnellement mélange
- * puis charge `deck_`.
+ * Copie `src.all()` dans `all_` (et les poids associés), initialise le RNG avec `seed`,
+ * puis charge `deck_` selon le mode de tirage :
+ * - `Shuffle` / `WeightedShuffle` : ordre du catalogue si `shuffle` est faux (sans les tuiles
+ *   de poids nul en mode pondéré), sinon ordre tiré ;
+ * - `WeightedWithReplacement` : fenêtre d’anticipation tirée avec remise.
+ *
+ * Indexe le catalogue par identifiant et initialise les compteurs de composition.
  *
  * @param src Source des tuiles.
  * @param shuffle Si vrai, mélange l’ordre initial.
  * @param seed Graine de mélange (défaut: `std::random_device{ }()`).
- * @return true si au moins une tuile était disponible, false sinon.
+ * @return true si au moins une tuile était disponible (de poids > 0 en mode pondéré), false sinon
+ *         (la file est alors laissée telle quelle).
  */
 bool TileQueue::initFrom(const InitTiles& src, bool shuffle, std::uint32_t seed) {
     const auto& v = src.all();
     if (v.empty()) return false;
+    // Poids validés avant toute modification : un échec laisse la file intacte.
+    std::vector<double> weights = src.weights();
+    weights.resize(v.size(), 1.0);
+    AliasTable alias;
+    if (!alias.build(weights) && mode_ != SamplingMode::Shuffle) return false;
     all_ = v;
+    weights_ = std::move(weights);
+    alias_ = std::move(alias);
+
+    indexById_.clear();
+    std::size_t maxCells = 0;
+    for (std::size_t i = 0; i < all_.size(); ++i) {
+        indexById_.emplace(all_[i].getId(), i);
+        maxCells = std::max(maxCells, all_[i].getCells().size());
+    }
+    shapeRemaining_.assign(all_.size(), 0);
+    sizeRemaining_.assign(maxCells + 1, 0);
     rng_.seed(seed);
-    std::vector<Tile> tmp = all_;
-    if (shuffle) std::shuffle(tmp.begin(), tmp.end(), rng_);
-    deck_.assign(tmp.begin(), tmp.end());
+
+    if (mode_ == SamplingMode::WeightedWithReplacement) {
+        deck_.clear();
+        recount_();
+        refillWithReplacement_();
+        return true;
+    }
+    if (shuffle) {
+        reshuffle_();
+    } else {
+        deck_.clear();
+        for (std::size_t i = 0; i < all_.size(); ++i)
+            if (mode_ == SamplingMode::Shuffle || weights_[i] > 0.0) deck_.push_back(all_[i]);
+        recount_();
+    }
     return true;
 }
 
@@ -45,6 +80,7 @@ bool TileQueue::initFrom(const InitTiles& src, bool shuffle, std::uint32_t seed)
  *
  * - Si `deck_` est vide et `reshuffleOnExhaustion_` est vrai, reconstitue et mélange avant de tirer.
  * - Si `deck_` est vide et `reshuffleOnExhaustion_` est faux, lance `std::runtime_error`.
+ * - En mode avec remise, la fenêtre d’anticipation est complétée par un nouveau tirage O(1).
  *
  * @return La tuile tirée.
  * @throws std::runtime_error Si la pioche est vide et la reconstitution désactivée.
@@ -52,11 +88,13 @@ bool TileQueue::initFrom(const InitTiles& src, bool shuffle, std::uint32_t seed)
 Tile TileQueue::draw() {
     if (deck_.empty()) {
         if (reshuffleOnExhaustion_) reshuffle_();
-        else throw std::runtime_error("draw on empty deck");
+        if (deck_.empty()) throw std::runtime_error("draw on empty deck");
     }
     Tile t = deck_.front();
     deck_.pop_front();
-    if (deck_.empty() && reshuffleOnExhaustion_) reshuffle_();
+    track_(t, -1);
+    if (mode_ == SamplingMode::WeightedWithReplacement) refillWithReplacement_();
+    else if (deck_.empty() && reshuffleOnExhaustion_) reshuffle_();
     return t;
 }
 
@@ -75,11 +113,167 @@ std::vector<Tile> TileQueue::peek(std::size_t count) const {
 
 /**
  * @brief Reconstitue et mélange la pioche à partir de `all_`.
+ *
+ * Mode `Shuffle` : permutation uniforme. Mode `WeightedShuffle` : ordre pondéré
+ * (voir weightedOrder_()). Mode `WeightedWithReplacement` : recomplète la fenêtre.
  */
 void TileQueue::reshuffle_() {
+    if (mode_ == SamplingMode::WeightedWithReplacement) {
+        refillWithReplacement_();
+        return;
+    }
+    if (mode_ == SamplingMode::WeightedShuffle) {
+        deck_.clear();
+        for (std::size_t i : weightedOrder_()) deck_.push_back(all_[i]);
+        recount_();
+        return;
+    }
     std::vector<Tile> tmp = all_;
     std::shuffle(tmp.begin(), tmp.end(), rng_);
     deck_.assign(tmp.begin(), tmp.end());
+    recount_();
+}
+
+/**
+ * @brief Tirage successif pondéré sans remise par sommes cumulées (arbre de Fenwick).
+ *
+ * Chaque tirage choisit une tuile restante avec une probabilité proportionnelle à son poids :
+ * une valeur uniforme dans [0, poids restant) est localisée par descente dans l’arbre des
+ * sommes partielles, puis le poids de la tuile tirée est retiré de l’arbre. O(log n) par
+ * tirage, quels que soient les rapports de poids.
+ *
+ * @return Ordre de tirage (indices dans `all_`).
+ */
+std::vector<std::size_t> TileQueue::weightedOrder_() {
+    std::vector<std::size_t> pool;
+    std::vector<double> w;
+    for (std::size_t i = 0; i < all_.size(); ++i) {
+        if (weights_[i] > 0.0) { pool.push_back(i); w.push_back(weights_[i]); }
+    }
+    std::vector<std::size_t> order;
+    order.reserve(pool.size());
+    if (pool.empty()) return order;
+
+    // tree[k] (k >= 1) : somme des poids de pool[k - lowbit(k), k).
+    const std::size_t n = pool.size();
+    std::vector<double> tree(n + 1, 0.0);
+    double total = 0.0;
+    for (std::size_t k = 1; k <= n; ++k) {
+        tree[k] += w[k - 1];
+        total += w[k - 1];
+        const std::size_t parent = k + (k & (~k + 1));
+        if (parent <= n) tree[parent] += tree[k];
+    }
+    std::size_t top = 1;
+    while (top * 2 <= n) top *= 2;
+
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    for (std::size_t remaining = n; remaining > 0; --remaining) {
+        double u = unit(rng_) * total;
+        std::size_t k = 0;
+        for (std::size_t step = top; step > 0; step /= 2) {
+            if (k + step <= n && tree[k + step] <= u) {
+                k += step;
+                u -= tree[k];
+            }
+        }
+        // Erreurs d’arrondi : k peut dépasser n ou désigner une tuile déjà sortie.
+        if (k >= n || w[k] <= 0.0) {
+            std::size_t j = std::min(k, n - 1);
+            while (j > 0 && w[j] <= 0.0) --j;
+            if (w[j] <= 0.0) while (w[j] <= 0.0) ++j;
+            k = j;
+        }
+        order.push_back(pool[k]);
+        const double wk = w[k];
+        w[k] = 0.0;
+        total -= wk;
+        for (std::size_t j = k + 1; j <= n; j += j & (~j + 1)) tree[j] -= wk;
+    }
+    return order;
+}
+
+/**
+ * @brief Complète `deck_` jusqu’à `kLookahead` tuiles par des tirages indépendants pondérés.
+ */
+void TileQueue::refillWithReplacement_() {
+    if (alias_.empty()) return;
+    while (deck_.size() < kLookahead) {
+        deck_.push_back(all_[alias_.sample(rng_)]);
+        track_(deck_.back(), +1);
+    }
+}
+
+/**
+ * @brief Recalcule les compteurs par forme et par taille à partir du contenu de `deck_`.
+ *
+ * Coût O(|deck_|), appelé uniquement à l’initialisation et au remélange
+ * (qui sont eux-mêmes en O(|deck_|)).
+ */
+void TileQueue::recount_() {
+    std::fill(shapeRemaining_.begin(), shapeRemaining_.end(), 0);
+    std::fill(sizeRemaining_.begin(), sizeRemaining_.end(), 0);
+    for (const auto& t : deck_) track_(t, +1);
+}
+
+/**
+ * @brief Applique une entrée (+1) ou une sortie (-1) de la pioche aux compteurs.
+ *
+ * Les tuiles dont l’identifiant n’appartient pas au catalogue sont ignorées.
+ *
+ * @param t Tuile concernée.
+ * @param delta +1 ou -1.
+ */
+void TileQueue::track_(const Tile& t, int delta) {
+    auto it = indexById_.find(t.getId());
+    if (it == indexById_.end()) return;
+    std::size_t n = t.getCells().size();
+    if (delta > 0) {
+        ++shapeRemaining_[it->second];
+        if (n < sizeRemaining_.size()) ++sizeRemaining_[n];
+    } else {
+        --shapeRemaining_[it->second];
+        if (n < sizeRemaining_.size()) --sizeRemaining_[n];
+    }
+}
+
+/**
+ * @brief Retrouve l’indice d’une forme du catalogue à partir de son identifiant.
+ * @param id Identifiant recherché.
+ * @return L’indice dans `all_`, sinon `std::nullopt`.
+ */
+std::optional<std::size_t> TileQueue::shapeIndex(const std::string& id) const {
+    auto it = indexById_.find(id);
+    if (it == indexById_.end()) return std::nullopt;
+    return it->second;
+}
+
+/**
+ * @brief Nombre d’exemplaires restants d’une forme avant remélange.
+ * @param shapeIndex Indice de la forme dans `all_`.
+ * @return Compteur courant, 0 si l’indice est invalide.
+ */
+std::size_t TileQueue::remainingOfShape(std::size_t shapeIndex) const {
+    return shapeIndex < shapeRemaining_.size() ? shapeRemaining_[shapeIndex] : 0;
+}
+
+/**
+ * @brief Nombre d’exemplaires restants d’une forme (par identifiant) avant remélange.
+ * @param id Identifiant de la tuile.
+ * @return Compteur courant, 0 si l’identifiant est inconnu.
+ */
+std::size_t TileQueue::remainingOfShape(const std::string& id) const {
+    auto idx = shapeIndex(id);
+    return idx ? shapeRemaining_[*idx] : 0;
+}
+
+/**
+ * @brief Nombre de tuiles d’une taille donnée restantes avant remélange.
+ * @param cellCount Nombre de cases des tuiles recherchées.
+ * @return Compteur courant, 0 si aucune tuile de cette taille.
+ */
+std::size_t TileQueue::remainingOfSize(std::size_t cellCount) const {
+    return cellCount < sizeRemaining_.size() ? sizeRemaining_[cellCount] : 0;
 }
 
 /**
@@ -112,6 +306,7 @@ std::vector<std::string> TileQueue::nextTileIds(std::size_t count) const {
  * - `index` doit être < 5 et < `deck_.size()` ;
  * - `currentId` doit exister dans `all_` ;
  * - Échange la tuile à `index` contre celle d’ID `currentId`, et retourne l’ancienne tuile de la fenêtre.
+ * - Les compteurs de composition sont ajustés (sortie de la tuile de fenêtre, entrée de la tuile courante).
  *
  * @param index Index dans la fenêtre (0..4).
  * @param currentId ID de la tuile courante à replacer dans la fenêtre.
@@ -124,7 +319,9 @@ std::optional<Tile> TileQueue::exchangeWithWindow(std::size_t index, const std::
     if (!curOpt) return std::nullopt;
 
     Tile newCurrent = deck_[index];
+    track_(newCurrent, -1);
     deck_[index] = *curOpt;
+    track_(deck_[index], +1);
     return newCurrent;
 }
 
@@ -0,0 +1,1262 @@
+/**
+* @file tests.cpp
+ * @brief Tests différentiels des noyaux rapides : chaque résultat est comparé à la règle de
+ *        référence (Game::canPlaceFootprint) ou à un recalcul complet.
+ *
+ * Les tests sont lancés depuis le dossier de build, où Shapes.json est copié.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "AI/AlphaBetaAgent.hpp"
+#include "AI/FinalCellSolver.hpp"
+#include "AI/HeuristicPolicy.hpp"
+#include "AI/MctsAgent.hpp"
+#include "AI/Ponderer.hpp"
+#include "AI/OpeningBook.hpp"
+#include "AI/StoneAdvisor.hpp"
+#include "Board/Board.hpp"
+#include "Engine/BatchLegality.hpp"
+#include "Engine/BatchPlayout.hpp"
+#include "Engine/BitGrid.hpp"
+#include "Engine/Coverage.hpp"
+#include "Engine/MoveGenerator.hpp"
+#include "Engine/PlacementCache.hpp"
+#include "Engine/Playout.hpp"
+#include "Engine/Position.hpp"
+#include "Engine/Shape.hpp"
+#include "Engine/Territory.hpp"
+#include "Game/Game.hpp"
+#include "Player/Player.hpp"
+#include "Tile/AliasTable.hpp"
+#include "Tile/InitTiles.hpp"
+#include "Tile/TileQueue.hpp"
+
+namespace {
+
+/** @brief Orientations du catalogue (chargé une fois). */
+const std::vector<ShapeSet>& catalog() {
+    static const std::vector<ShapeSet> shapes = [] {
+        std::vector<ShapeSet> out;
+        InitTiles tiles("Shapes.json");
+        for (const auto& t : tiles.all()) out.emplace_back(t);
+        return out;
+    }();
+    return shapes;
+}
+
+/** @brief Pioche de simulation du catalogue (mélange pondéré à graine fixe, construite une fois). */
+const TileBag& tileBag() {
+    static const InitTiles tiles("Shapes.json");
+    static TileQueue queue;
+    static const TileBag bag = [] {
+        queue.setSamplingMode(TileQueue::SamplingMode::WeightedShuffle);
+        queue.initFrom(tiles, true, 50);
+        return TileBag::fromQueue(queue, queue.weights());
+    }();
+    return bag;
+}
+
+/** @brief Joueurs d’une partie de n joueurs. */
+std::vector<Player> makePlayers(int n) {
+    std::vector<Player> players;
+    for (int p = 0; p < n; ++p) players.emplace_back("p" + std::to_string(p), "red");
+    return players;
+}
+
+/**
+ * @brief Règle de placement de référence (Game::canPlaceFootprint, sur les grilles de Board) :
+ *        cases dans le plateau et vides ('.'), aucune voisine adverse, au moins une voisine à soi.
+ */
+bool referenceLegal(const Board& board, const std::vector<std::pair<int,int>>& pts, int playerId) {
+    const auto& grid = board.getGrid();
+    const auto& owners = board.getOwnerGrid();
+    for (auto [x, y] : pts) {
+        if (x < 0 || x >= board.getCols() || y < 0 || y >= board.getRows()) return false;
+        if (grid[y][x] != '.') return false;
+    }
+    static const int DX[4] = { 1, -1, 0, 0 };
+    static const int DY[4] = { 0, 0, 1, -1 };
+    bool touchesOwn = false;
+    for (auto [x, y] : pts) {
+        for (int k = 0; k < 4; ++k) {
+            const int nx = x + DX[k], ny = y + DY[k];
+            if (nx < 0 || nx >= board.getCols() || ny < 0 || ny >= board.getRows()) continue;
+            const int owner = owners[ny][nx];
+            if (owner == 0) continue;
+            if (owner != playerId) return false;
+            touchesOwn = true;
+        }
+    }
+    return touchesOwn;
+}
+
+/** @brief Plateau aléatoire : bonus, puis cases de territoire et pierres tirées au hasard. */
+Board randomBoard(const std::vector<Player>& players, std::mt19937& rng) {
+    const int n = static_cast<int>(players.size());
+    Board board(n);
+    board.placeBonus(n, rng);
+    const int rows = board.getRows(), cols = board.getCols();
+    const int cells = static_cast<int>(rng() % (rows * cols / 3));
+    for (int i = 0; i < cells; ++i) {
+        const int x = static_cast<int>(rng() % cols), y = static_cast<int>(rng() % rows);
+        if (board.getGrid()[y][x] != '.') continue;
+        if (rng() % 16 == 0) board.placeStone(x, y);
+        else board.placeTile(x, y, players[rng() % n].getID());
+    }
+    return board;
+}
+
+/** @brief Compare tous les masques d’une position incrémentale à ceux d’une photographie. */
+void expectSamePosition(const Position& a, const Position& b) {
+    ASSERT_EQ(a.numSeats(), b.numSeats());
+    for (int y = 0; y < a.rows(); ++y) {
+        EXPECT_EQ(a.empty()[y], b.empty()[y]) << "empty, row " << y;
+        EXPECT_EQ(a.neutral()[y], b.neutral()[y]) << "neutral, row " << y;
+        for (int s = 0; s < a.numSeats(); ++s) {
+            EXPECT_EQ(a.owned(s)[y], b.owned(s)[y]) << "owned, seat " << s << ", row " << y;
+            EXPECT_EQ(a.anchors(s)[y], b.anchors(s)[y]) << "anchors, seat " << s << ", row " << y;
+        }
+    }
+}
+
+/** @brief Position de milieu de partie : bonus, cases de départ, puis coups et pierres au hasard. */
+Position randomGame(const std::vector<Player>& players, int turns, std::mt19937& rng) {
+    const int n = static_cast<int>(players.size());
+    Board board(n);
+    board.placeBonus(n, rng);
+    Position pos = Position::fromBoard(board, players, 1, 0);
+    for (int s = 0; s < n; ++s) {
+        int x, y;
+        do {
+            x = static_cast<int>(rng() % pos.cols());
+            y = static_cast<int>(rng() % pos.rows());
+        } while (board.getGrid()[y][x] != '.' || !pos.isEmpty(x, y));
+        pos.placeCell(s, x, y);
+    }
+    MoveList moves;
+    for (int turn = 0; turn < turns; ++turn) {
+        const int seat = turn % n;
+        if (rng() % 10 == 0) {
+            pos.placeStone(static_cast<int>(rng() % pos.cols()), static_cast<int>(rng() % pos.rows()));
+            continue;
+        }
+        const ShapeSet& shape = catalog()[rng() % catalog().size()];
+        MoveGenerator::generate(pos.masks(seat), shape, moves);
+        if (moves.empty()) continue;
+        const Move m = moves[rng() % moves.size()];
+        pos.place(seat, shape.orientations()[m.orientation], m.x, m.y);
+    }
+    return pos;
+}
+
+/**
+ * @brief Masque principal d’une politique à score (HeuristicPolicy::choose), recalculé case
+ *        par case : côtés libres des bonus capturables les plus proches, cases libres sur ou
+ *        à côté d’une ancre adverse, ou cases libres des fenêtres de côté k + 1 possédées ou
+ *        libres contenant une case possédée (k : plus grand carré du siège).
+ */
+BitGrid referencePrimary(const Position& pos, int seat, HeuristicPolicy::Kind kind) {
+    const PlacementMasks masks = pos.masks(seat);
+    const auto inside = [&](int x, int y) { return x >= 0 && x < pos.cols() && y >= 0 && y < pos.rows(); };
+    const auto bit = [](const BitGrid& g, int x, int y) { return ((g[y] >> x) & 1u) != 0; };
+    static const int DX[5] = { 0, 1, -1, 0, 0 };
+    static const int DY[5] = { 0, 0, 0, 1, -1 };
+    BitGrid primary{};
+    bool found = false;
+    if (kind == HeuristicPolicy::Kind::BonusSeeker) {
+        int nearest = 5;
+        for (int i = 0; i < pos.bonusCount(); ++i) {
+            const int d = pos.bonusDistance(i, seat);
+            if (d > 0) nearest = std::min(nearest, d);
+        }
+        for (int i = 0; i < pos.bonusCount() && nearest < 5; ++i) {
+            if (pos.bonusDistance(i, seat) != nearest) continue;
+            for (int k = 1; k < 5; ++k) {
+                const int x = pos.bonusX(i) + DX[k], y = pos.bonusY(i) + DY[k];
+                if (!inside(x, y) || !bit(masks.free, x, y)) continue;
+                primary[y] |= Row(1) << x;
+                found = true;
+            }
+        }
+    } else if (kind == HeuristicPolicy::Kind::Blocker) {
+        for (int y = 0; y < pos.rows(); ++y) {
+            for (int x = 0; x < pos.cols(); ++x) {
+                if (!bit(masks.free, x, y)) continue;
+                for (int k = 0; k < 5; ++k) {
+                    const int nx = x + DX[k], ny = y + DY[k];
+                    for (int s = 0; s < pos.numSeats() && inside(nx, ny); ++s)
+                        if (s != seat && bit(pos.anchors(s), nx, ny)) primary[y] |= Row(1) << x;
+                }
+            }
+        }
+        found = true;
+    }
+    if (found) return primary;
+    const int side = pos.maxSquare(seat) + 1;
+    for (int y0 = 0; y0 + side <= pos.rows(); ++y0) {
+        for (int x0 = 0; x0 + side <= pos.cols(); ++x0) {
+            bool usable = true, owned = false;
+            for (int y = y0; y < y0 + side; ++y) {
+                for (int x = x0; x < x0 + side; ++x) {
+                    owned = owned || bit(pos.owned(seat), x, y);
+                    usable = usable && (bit(pos.owned(seat), x, y) || bit(masks.free, x, y));
+                }
+            }
+            if (!usable || !owned) continue;
+            for (int y = y0; y < y0 + side; ++y)
+                for (int x = x0; x < x0 + side; ++x)
+                    if (bit(masks.free, x, y)) primary[y] |= Row(1) << x;
+        }
+    }
+    return primary;
+}
+
+/** @brief Secondes écoulées depuis t0. */
+double secondsSince(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+/**
+ * @brief Vérifie une décision de tour : tuile en main ou tuile de la fenêtre échangée (avec un
+ *        coupon), placement parmi ceux du générateur ; un abandon n’est permis que sans placement.
+ */
+void expectLegalDecision(const TurnContext& ctx, const TurnDecision& d, const std::string& what) {
+    const int seat = ctx.position.toMove();
+    MoveList moves;
+    if (d.exchangeSlot >= 0) {
+        ASSERT_LT(d.exchangeSlot, ctx.bag.knownCount()) << what;
+        EXPECT_GT(ctx.position.coupons(seat), 0) << what;
+        EXPECT_EQ(d.tile, ctx.bag.known(d.exchangeSlot)) << what;
+    } else {
+        EXPECT_EQ(d.tile, ctx.tile) << what;
+    }
+    if (d.pass) {
+        MoveGenerator::generate(ctx.position.masks(seat), ctx.catalog[ctx.tile], moves);
+        EXPECT_TRUE(moves.empty()) << what << ": pass with a legal placement";
+        return;
+    }
+    ASSERT_GE(d.tile, 0) << what;
+    MoveGenerator::generate(ctx.position.masks(seat), ctx.catalog[d.tile], moves);
+    EXPECT_TRUE(std::any_of(moves.begin(), moves.end(), [&](const Move& m) {
+        return m.orientation == d.move.orientation && m.x == d.move.x && m.y == d.move.y;
+    })) << what << ": illegal placement";
+}
+
+
+/**
+ * @brief Écrit un petit catalogue (formes distinctes en barre, poids donnés) au format de
+ *        Shapes.json.
+ */
+void writeCatalog(const std::string& path, const std::vector<double>& weights) {
+    std::ofstream f(path);
+    f << "{ \"tiles\": [";
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+        f << (i ? ", " : "") << "{ \"id\": \"T" << i << "\", \"cells\": [";
+        for (std::size_t c = 0; c <= i; ++c) f << (c ? ", " : "") << "[" << c << ", 0]";
+        f << "], \"weight\": " << weights[i] << " }";
+    }
+    f << "] }";
+}
+
+} // namespace
+
+TEST(MoveGenerator, LegalOriginsMatchReferenceRule) {
+    ASSERT_FALSE(catalog().empty());
+    std::mt19937 rng(28);
+    for (int n : { 2, 4, 7 }) {
+        const std::vector<Player> players = makePlayers(n);
+        for (int trial = 0; trial < 6; ++trial) {
+            const Board board = randomBoard(players, rng);
+            for (const Player& player : players) {
+                const PlacementMasks masks = MoveGenerator::masksFor(board, player.getID());
+                for (const ShapeSet& shape : catalog()) {
+                    for (const Orientation& o : shape.orientations()) {
+                        const BitGrid origins = MoveGenerator::legalOrigins(masks, o);
+                        for (int y = 0; y < board.getRows(); ++y) {
+                            const Row row = y + o.height <= masks.rows
+                                ? MoveGenerator::legalRow(masks, o, y, columnsMask(masks.cols - o.width + 1))
+                                : Row(0);
+                            EXPECT_EQ(row, origins[y]);
+                            for (int x = 0; x < board.getCols(); ++x) {
+                                std::vector<std::pair<int,int>> pts;
+                                for (int i = 0; i < o.cellCount; ++i)
+                                    pts.emplace_back(x + o.cells[i].first, y + o.cells[i].second);
+                                ASSERT_EQ(referenceLegal(board, pts, player.getID()), ((origins[y] >> x) & 1u) != 0)
+                                    << shape.tileId() << " at (" << x << ", " << y << ") for player " << player.getID();
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(MoveGenerator, GenerateListsEveryLegalOrigin) {
+    std::mt19937 rng(2028);
+    const std::vector<Player> players = makePlayers(3);
+    MoveList moves;
+    for (int trial = 0; trial < 8; ++trial) {
+        const Board board = randomBoard(players, rng);
+        const PlacementMasks masks = MoveGenerator::masksFor(board, players[0].getID());
+        for (const ShapeSet& shape : catalog()) {
+            std::size_t expected = 0;
+            for (const Orientation& o : shape.orientations()) {
+                const BitGrid origins = MoveGenerator::legalOrigins(masks, o);
+                for (int y = 0; y < masks.rows; ++y) expected += popCount(origins[y]);
+            }
+            MoveGenerator::generate(masks, shape, moves);
+            EXPECT_EQ(moves.size(), expected);
+            EXPECT_EQ(MoveGenerator::countMoves(masks, shape), expected);
+            EXPECT_EQ(MoveGenerator::hasAnyMove(masks, shape), expected > 0);
+            for (const Move& m : moves)
+                EXPECT_TRUE(referenceLegal(board, MoveGenerator::footprint(shape, m), players[0].getID()));
+        }
+    }
+}
+
+TEST(Position, IncrementalMatchesSnapshotAfterEveryMove) {
+    std::mt19937 rng(29);
+    for (int n : { 2, 4, 6, 9 }) {
+        const std::vector<Player> players = makePlayers(n);
+        // Sans bonus : leur capture passe par Game, hors de portée de Board seul.
+        Board board(n);
+        Position pos = Position::fromBoard(board, players, 1, 0);
+        for (int s = 0; s < n; ++s) {
+            int x, y;
+            do {
+                x = static_cast<int>(rng() % board.getCols());
+                y = static_cast<int>(rng() % board.getRows());
+            } while (!pos.isEmpty(x, y));
+            pos.placeCell(s, x, y);
+            board.placeTile(x, y, players[s].getID());
+        }
+        expectSamePosition(pos, Position::fromBoard(board, players, 1, 0));
+
+        MoveList moves;
+        for (int turn = 0; turn < 12 * n; ++turn) {
+            const int seat = turn % n;
+            if (rng() % 8 == 0) {
+                const int x = static_cast<int>(rng() % board.getCols()), y = static_cast<int>(rng() % board.getRows());
+                EXPECT_EQ(pos.placeStone(x, y), board.placeStone(x, y));
+            } else {
+                const ShapeSet& shape = catalog()[rng() % catalog().size()];
+                MoveGenerator::generate(pos.masks(seat), shape, moves);
+                if (moves.empty()) continue;
+                const Move m = moves[rng() % moves.size()];
+                pos.place(seat, shape.orientations()[m.orientation], m.x, m.y);
+                ASSERT_TRUE(board.placeFootprint(MoveGenerator::footprint(shape, m), players[seat].getID()));
+            }
+            const Position snapshot = Position::fromBoard(board, players, 1, 0);
+            expectSamePosition(pos, snapshot);
+            for (int s = 0; s < n; ++s) {
+                const PlacementMasks a = pos.masks(s), b = MoveGenerator::masksFor(board, players[s].getID());
+                for (int y = 0; y < a.rows; ++y) {
+                    EXPECT_EQ(a.free[y], b.free[y]);
+                    EXPECT_EQ(a.anchors[y], b.anchors[y]);
+                }
+                EXPECT_EQ(pos.cellCount(s), snapshot.cellCount(s));
+                EXPECT_EQ(pos.maxSquare(s), snapshot.maxSquare(s));
+            }
+            if (HasFatalFailure() || HasNonfatalFailure()) return;
+        }
+    }
+}
+
+TEST(PlacementCache, MatchesFullRecomputeAfterEveryMove) {
+    std::mt19937 rng(30);
+    const std::vector<Player> players = makePlayers(4);
+    Board board(4);
+    board.placeBonus(4, rng);
+    for (const Player& p : players) {
+        int x, y;
+        do {
+            x = static_cast<int>(rng() % board.getCols());
+            y = static_cast<int>(rng() % board.getRows());
+        } while (board.getGrid()[y][x] != '.');
+        board.placeTile(x, y, p.getID());
+    }
+
+    PlacementCache cache(board);
+    MoveList moves;
+    for (int turn = 0; turn < 48; ++turn) {
+        const Player& mover = players[turn % players.size()];
+        if (rng() % 8 == 0) {
+            board.placeStone(static_cast<int>(rng() % board.getCols()), static_cast<int>(rng() % board.getRows()));
+        } else {
+            const ShapeSet& shape = catalog()[rng() % catalog().size()];
+            MoveGenerator::generate(board, mover.getID(), shape, moves);
+            if (!moves.empty())
+                board.placeFootprint(MoveGenerator::footprint(shape, moves[rng() % moves.size()]), mover.getID());
+        }
+        // Un sous-ensemble des tuiles à chaque tour : certaines entrées vieillissent de plusieurs coups.
+        for (const Player& p : players) {
+            const PlacementMasks masks = MoveGenerator::masksFor(board, p.getID());
+            for (std::size_t t = turn % 3; t < catalog().size(); t += 3) {
+                const ShapeSet& shape = catalog()[t];
+                std::size_t expected = 0;
+                for (int i = 0; i < static_cast<int>(shape.orientations().size()); ++i) {
+                    const BitGrid full = MoveGenerator::legalOrigins(masks, shape.orientations()[i]);
+                    const BitGrid& cached = cache.legalOrigins(p.getID(), shape, i);
+                    for (int y = 0; y < masks.rows; ++y) {
+                        ASSERT_EQ(cached[y], full[y]) << shape.tileId() << " orientation " << i << ", row " << y;
+                        expected += popCount(full[y]);
+                    }
+                }
+                ASSERT_EQ(cache.countMoves(p.getID(), shape), expected);
+            }
+        }
+    }
+    EXPECT_GT(cache.stats().incrementalUpdates, 0u);
+}
+
+TEST(PlacementCache, DistinctBoardsNeverShareVersions) {
+    Board a(2), b(2);
+    EXPECT_NE(a.getVersion() >> 32, b.getVersion() >> 32);
+}
+
+TEST(StoneAdvisor, RankMatchesStonePlayedOnACopy) {
+    std::mt19937 rng(39);
+    const StoneAdvisor advisor;
+    std::vector<ShapeSet> shapes;
+    for (std::size_t t = 0; t < catalog().size(); t += 4) shapes.push_back(catalog()[t]);
+    for (int n : { 2, 5 }) {
+        const std::vector<Player> players = makePlayers(n);
+        const Position pos = randomGame(players, 6 * n, rng);
+        const int seat = static_cast<int>(rng() % n);
+        std::array<std::size_t, kMaxPlayers> before{};
+        for (int s = 0; s < n; ++s)
+            for (const ShapeSet& shape : shapes) before[s] += MoveGenerator::countMoves(pos.masks(s), shape);
+
+        const auto options = advisor.rank(pos, seat, shapes, kMaxSide * kMaxSide);
+        int empties = 0;
+        for (int y = 0; y < pos.rows(); ++y) empties += popCount(pos.empty()[y]);
+        ASSERT_EQ(static_cast<int>(options.size()), empties);
+
+        for (const StoneAdvisor::Option& o : options) {
+            Position next = pos;
+            ASSERT_TRUE(next.placeStone(o.x, o.y));
+            int own = 0, opponents = 0, squares = 0;
+            for (int s = 0; s < n; ++s) {
+                std::size_t after = 0;
+                for (const ShapeSet& shape : shapes) after += MoveGenerator::countMoves(next.masks(s), shape);
+                (s == seat ? own : opponents) += static_cast<int>(before[s] - after);
+                if (s == seat) continue;
+
+                // Carrés de croissance (côté k+1, au plus 2k+1 cases vides) recouvrant la case, case par case.
+                const PlacementMasks m = pos.masks(s);
+                const int k = pos.maxSquare(s), side = k + 1;
+                auto usable = [&](int x, int y) { return ((pos.owned(s)[y] | m.free[y]) >> x) & 1u; };
+                auto free = [&](int x, int y) { return (m.free[y] >> x) & 1u; };
+                if (!free(o.x, o.y)) continue;
+                for (int y0 = std::max(0, o.y - k); y0 <= o.y && y0 + side <= pos.rows(); ++y0) {
+                    for (int x0 = std::max(0, o.x - k); x0 <= o.x && x0 + side <= pos.cols(); ++x0) {
+                        bool ok = true;
+                        int empty = 0;
+                        for (int y = y0; y < y0 + side && ok; ++y)
+                            for (int x = x0; x < x0 + side && ok; ++x) {
+                                ok = usable(x, y);
+                                empty += free(x, y);
+                            }
+                        squares += ok && empty <= 2 * k + 1;
+                    }
+                }
+            }
+            EXPECT_EQ(o.ownPlacements, own) << "(" << o.x << ", " << o.y << ")";
+            EXPECT_EQ(o.opponentPlacements, opponents) << "(" << o.x << ", " << o.y << ")";
+            EXPECT_EQ(o.squaresBlocked, squares) << "(" << o.x << ", " << o.y << ")";
+        }
+        for (std::size_t i = 1; i < options.size(); ++i) EXPECT_GE(options[i - 1].score, options[i].score);
+    }
+}
+
+TEST(FinalCellSolver, EvaluateMatchesCellPlayedOnACopy) {
+    std::mt19937 rng(40);
+    for (int n : { 2, 3, 6 }) {
+        const std::vector<Player> players = makePlayers(n);
+        for (int trial = 0; trial < 4; ++trial) {
+            const Position pos = randomGame(players, 10 * n, rng);
+            for (int seat = 0; seat < n; ++seat) {
+                const auto choices = FinalCellSolver::evaluate(pos, seat);
+                int anchors = 0;
+                for (int y = 0; y < pos.rows(); ++y) anchors += popCount(pos.anchors(seat)[y]);
+                ASSERT_EQ(static_cast<int>(choices.size()), anchors);
+
+                std::optional<FinalCellSolver::Choice> expected;
+                for (const FinalCellSolver::Choice& c : choices) {
+                    ASSERT_TRUE((pos.anchors(seat)[c.y] >> c.x) & 1u);
+                    Position next = pos;
+                    next.placeCell(seat, c.x, c.y);
+                    EXPECT_EQ(c.maxSquare, next.maxSquare(seat)) << "(" << c.x << ", " << c.y << ")";
+                    EXPECT_EQ(c.cellCount, next.cellCount(seat)) << "(" << c.x << ", " << c.y << ")";
+                    EXPECT_EQ(c.squareGain, c.maxSquare - pos.maxSquare(seat));
+                    EXPECT_EQ(c.cellGain, c.cellCount - pos.cellCount(seat));
+                    if (!expected || c.maxSquare > expected->maxSquare
+                        || (c.maxSquare == expected->maxSquare && c.cellCount > expected->cellCount))
+                        expected = c;
+                }
+                const auto best = FinalCellSolver::best(pos, seat);
+                ASSERT_EQ(best.has_value(), expected.has_value());
+                if (best) {
+                    EXPECT_EQ(best->x, expected->x);
+                    EXPECT_EQ(best->y, expected->y);
+                }
+            }
+        }
+    }
+}
+
+TEST(BatchLegality, MatchesMoveGeneratorForTheWholeBatch) {
+    std::mt19937 rng(45);
+    BatchLegality batch;
+    MoveList expected, got;
+    for (int n : { 2, 4, 8 }) {
+        const std::vector<Player> players = makePlayers(n);
+        for (int trial = 0; trial < 6; ++trial) {
+            const Board board = randomBoard(players, rng);
+            // Main et fenêtre d’aperçu, avec une tuile en double.
+            batch.clear();
+            for (int i = 0; i < 5; ++i) batch.add(catalog()[rng() % catalog().size()]);
+            batch.add(batch.shape(0));
+            for (const Player& player : players) {
+                const PlacementMasks masks = MoveGenerator::masksFor(board, player.getID());
+                batch.run(masks);
+                for (int i = 0; i < batch.size(); ++i) {
+                    const ShapeSet& shape = batch.shape(i);
+                    for (int o = 0; o < static_cast<int>(shape.orientations().size()); ++o) {
+                        const BitGrid full = MoveGenerator::legalOrigins(masks, shape.orientations()[o]);
+                        for (int y = 0; y < masks.rows; ++y)
+                            ASSERT_EQ(batch.origins(i, o)[y], full[y]) << shape.tileId() << " orientation " << o << ", row " << y;
+                    }
+                    MoveGenerator::generate(masks, shape, expected);
+                    batch.moves(i, got);
+                    EXPECT_EQ(batch.count(i), static_cast<int>(expected.size()));
+                    EXPECT_EQ(batch.any(i), !expected.empty());
+                    ASSERT_EQ(got.size(), expected.size());
+                    for (std::size_t m = 0; m < got.size(); ++m) {
+                        EXPECT_EQ(got[m].orientation, expected[m].orientation);
+                        EXPECT_EQ(got[m].x, expected[m].x);
+                        EXPECT_EQ(got[m].y, expected[m].y);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(Coverage, UpdateMatchesFullComputeAfterEveryMove) {
+    std::mt19937 rng(43);
+    std::vector<ShapeSet> shapes;
+    for (std::size_t t = 0; t < catalog().size(); t += 5) shapes.push_back(catalog()[t]);
+    for (int n : { 3, 7 }) {
+        const std::vector<Player> players = makePlayers(n);
+        Position pos = randomGame(players, 0, rng);
+        Coverage incremental(shapes);
+        incremental.update(pos);
+        MoveList moves;
+        for (int turn = 0; turn < 8 * n; ++turn) {
+            const int seat = turn % n;
+            if (rng() % 8 == 0) {
+                pos.placeStone(static_cast<int>(rng() % pos.cols()), static_cast<int>(rng() % pos.rows()));
+            } else {
+                const ShapeSet& shape = catalog()[rng() % catalog().size()];
+                MoveGenerator::generate(pos.masks(seat), shape, moves);
+                if (!moves.empty()) {
+                    const Move m = moves[rng() % moves.size()];
+                    pos.place(seat, shape.orientations()[m.orientation], m.x, m.y);
+                }
+            }
+            // Une mise à jour sur deux : elle doit aussi absorber plusieurs poses.
+            if (turn % 2 == 0) continue;
+            incremental.update(pos);
+            Coverage full(shapes);
+            full.compute(pos);
+            for (int s = 0; s < n; ++s) {
+                ASSERT_EQ(incremental.grid(s), full.grid(s)) << "seat " << s << ", turn " << turn;
+                const Coverage::Features a = incremental.features(s), b = full.features(s);
+                EXPECT_EQ(a.coveredCells, b.coveredCells);
+                EXPECT_EQ(a.exclusiveCells, b.exclusiveCells);
+                EXPECT_EQ(a.totalCoverage, b.totalCoverage);
+                EXPECT_EQ(a.maxCoverage, b.maxCoverage);
+            }
+        }
+        // Référence indépendante des compteurs en tranches : placements comptés case par case.
+        for (int s = 0; s < n; ++s) {
+            std::vector<std::vector<int>> expected(pos.rows(), std::vector<int>(pos.cols(), 0));
+            for (const ShapeSet& shape : shapes) {
+                MoveGenerator::generate(pos.masks(s), shape, moves);
+                for (const Move& m : moves)
+                    for (auto [x, y] : MoveGenerator::footprint(shape, m)) ++expected[y][x];
+            }
+            EXPECT_EQ(incremental.grid(s), expected) << "seat " << s;
+        }
+    }
+}
+
+TEST(HeuristicPolicy, ScoredPoliciesPickALegalPlacementOfMaximalScore) {
+    std::mt19937 rng(46);
+    const HeuristicPolicy::Kind kinds[] = { HeuristicPolicy::Kind::Random, HeuristicPolicy::Kind::GreedySquare,
+                                            HeuristicPolicy::Kind::BonusSeeker, HeuristicPolicy::Kind::Blocker };
+    MoveList moves;
+    for (int n : { 2, 5, 9 }) {
+        const std::vector<Player> players = makePlayers(n);
+        for (int game = 0; game < 4; ++game) {
+            const Position pos = randomGame(players, 3 * n + static_cast<int>(rng() % (6 * n)), rng);
+            for (int seat = 0; seat < n; ++seat) {
+                const ShapeSet& shape = catalog()[rng() % catalog().size()];
+                MoveGenerator::generate(pos.masks(seat), shape, moves);
+                for (HeuristicPolicy::Kind kind : kinds) {
+                    const HeuristicPolicy policy(kind);
+                    Move m;
+                    const bool placed = policy.choose(pos, seat, shape, rng, m);
+                    ASSERT_EQ(placed, !moves.empty()) << HeuristicPolicy::name(kind);
+                    if (!placed) continue;
+                    ASSERT_TRUE(std::any_of(moves.begin(), moves.end(), [&](const Move& g) {
+                        return g.orientation == m.orientation && g.x == m.x && g.y == m.y;
+                    })) << HeuristicPolicy::name(kind);
+                    if (kind == HeuristicPolicy::Kind::Random) continue;
+
+                    // Score (principal, secondaire) : cases du placement dans chaque masque.
+                    const BitGrid primary = referencePrimary(pos, seat, kind);
+                    const BitGrid& secondary = pos.masks(seat).anchors;
+                    const auto score = [&](const Move& move) {
+                        std::pair<int,int> v{ 0, 0 };
+                        for (auto [x, y] : MoveGenerator::footprint(shape, move)) {
+                            v.first += (primary[y] >> x) & 1u;
+                            v.second += (secondary[y] >> x) & 1u;
+                        }
+                        return v;
+                    };
+                    std::pair<int,int> best{ -1, -1 };
+                    for (const Move& g : moves) best = std::max(best, score(g));
+                    EXPECT_EQ(score(m), best) << HeuristicPolicy::name(kind) << ", " << n << " players, seat " << seat;
+                }
+            }
+        }
+    }
+}
+
+TEST(Board, SeededBonusLayoutIsReproducible) {
+    for (int n : { 2, 6, 9 }) {
+        std::mt19937 a(48), b(48);
+        Board first(n), second(n);
+        first.placeBonus(n, a);
+        second.placeBonus(n, b);
+        ASSERT_EQ(first.getBonus().size(), second.getBonus().size());
+        auto it = second.getBonus().begin();
+        for (const auto& [cell, bonus] : first.getBonus()) {
+            EXPECT_EQ(cell, it->first);
+            EXPECT_EQ(bonus->getSymbol(), it->second->getSymbol());
+            ++it;
+        }
+    }
+}
+
+TEST(BatchPlayout, Avx2KernelMatchesScalarKernel) {
+    if (!BatchPlayout::avx2Available()) GTEST_SKIP() << "AVX2 unavailable";
+    std::mt19937 rng(50);
+    const TileBag& bag = tileBag();
+    BatchPlayout batch(catalog());
+    std::vector<std::array<SeatScore, kMaxPlayers>> scalar, avx2;
+    for (int n : { 2, 5, 9 }) {
+        const std::vector<Player> players = makePlayers(n);
+        // Groupe incomplet en fin de lot : 21 parties = 2 groupes pleins + 5 voies.
+        const std::vector<Position> starts(21, randomGame(players, 2 * n, rng));
+        FastRng a(n), b(n);
+        batch.setAvx2(false);
+        batch.run(starts, bag, a, scalar);
+        batch.setAvx2(true);
+        batch.run(starts, bag, b, avx2);
+        for (std::size_t g = 0; g < starts.size(); ++g) {
+            for (int seat = 0; seat < n; ++seat) {
+                EXPECT_EQ(scalar[g][seat].maxSquare, avx2[g][seat].maxSquare) << n << " players, game " << g;
+                EXPECT_EQ(scalar[g][seat].cellCount, avx2[g][seat].cellCount) << n << " players, game " << g;
+            }
+        }
+    }
+}
+
+TEST(BatchPlayout, ScoresFollowSerialPlayoutDistribution) {
+    std::mt19937 rng(50);
+    const TileBag& bag = tileBag();
+    const Playout playout(catalog());
+    const BatchPlayout batch(catalog());
+    constexpr int kGames = 1024;
+    for (int n : { 2, 6 }) {
+        const std::vector<Player> players = makePlayers(n);
+        const Position start = randomGame(players, n, rng);
+
+        // Moyenne et variance de chaque score, parties indépendantes.
+        FastRng fast(n);
+        std::array<std::array<double, 2>, kMaxPlayers> sum{}, sumSq{};
+        for (int g = 0; g < kGames; ++g) {
+            Position pos = start;
+            TileBag b = bag;
+            b.determinize(fast);
+            Playout::playRock(pos, fast);
+            const auto scores = playout.run(pos, b, b.draw(fast), fast);
+            for (int seat = 0; seat < n; ++seat) {
+                for (int k = 0; k < 2; ++k) {
+                    const double v = k == 0 ? scores[seat].maxSquare : scores[seat].cellCount;
+                    sum[seat][k] += v;
+                    sumSq[seat][k] += v * v;
+                }
+            }
+        }
+
+        // Lot : les voies d’un groupe partagent leurs tuiles, l’unité indépendante est le groupe.
+        std::vector<std::array<SeatScore, kMaxPlayers>> batchScores;
+        batch.run(std::vector<Position>(kGames, start), bag, fast, batchScores);
+        constexpr int kGroups = kGames / kBatchLanes;
+        for (int seat = 0; seat < n; ++seat) {
+            for (int k = 0; k < 2; ++k) {
+                double groupSum = 0.0, groupSumSq = 0.0;
+                for (int g = 0; g < kGroups; ++g) {
+                    double mean = 0.0;
+                    for (int l = 0; l < kBatchLanes; ++l) {
+                        const SeatScore& s = batchScores[g * kBatchLanes + l][seat];
+                        mean += (k == 0 ? s.maxSquare : s.cellCount) / double(kBatchLanes);
+                    }
+                    groupSum += mean;
+                    groupSumSq += mean * mean;
+                }
+                const double serialMean = sum[seat][k] / kGames;
+                const double serialVar = sumSq[seat][k] / kGames - serialMean * serialMean;
+                const double batchMean = groupSum / kGroups;
+                const double batchVar = groupSumSq / kGroups - batchMean * batchMean;
+                const double error = std::sqrt(serialVar / kGames + batchVar / kGroups);
+                EXPECT_LE(std::abs(batchMean - serialMean), 5.0 * error + 1e-9)
+                    << (k == 0 ? "maxSquare" : "cellCount") << ", " << n << " players, seat " << seat
+                    << ": serial " << serialMean << ", batch " << batchMean;
+            }
+        }
+    }
+}
+
+TEST(OpeningBook, SaveOpenLookupRoundTripsThroughEverySymmetry) {
+    const std::string path = "test_roundtrip.book";
+    for (int n : { 3, 6 }) {
+        const std::vector<Player> players = makePlayers(n);
+        const Position empty = Position::fromBoard(Board(n), players, 1, 0);
+        const int side = empty.rows();
+        // Cases de départ des sièges 0 et 1, siège 2 à placer ; coups du livre (repère du plateau).
+        const std::array<std::pair<int,int>, 2> starts{ { { 1, 2 }, { side - 3, side / 2 } } };
+        const std::array<std::pair<int,int>, 3> best{ { { 4, 1 }, { side / 2, side - 2 }, { 0, side - 1 } } };
+        auto build = [&](int symmetry) {
+            Position pos = empty;
+            for (int s = 0; s < 2; ++s) {
+                int x = starts[s].first, y = starts[s].second;
+                OpeningBook::transform(symmetry, false, side, x, y);
+                pos.placeCell(s, x, y);
+            }
+            return pos;
+        };
+
+        OpeningBook::Key key;
+        ASSERT_TRUE(OpeningBook::keyOf(build(0), 2, key));
+        BookEntry entry;
+        entry.key = key.hash;
+        entry.samples = 100;
+        entry.count = static_cast<std::uint8_t>(best.size());
+        for (std::size_t m = 0; m < best.size(); ++m) {
+            int x = best[m].first, y = best[m].second;
+            OpeningBook::transform(key.symmetry, false, side, x, y);
+            entry.moves[m] = { static_cast<std::uint8_t>(x), static_cast<std::uint8_t>(y),
+                               static_cast<std::uint16_t>(60000 - m) };
+        }
+        ASSERT_TRUE(OpeningBook::save(path, { entry }));
+        OpeningBook book;
+        ASSERT_TRUE(book.open(path));
+        EXPECT_EQ(book.size(), 1u);
+
+        std::array<BookMove, kBookMoves> out;
+        for (int k = 0; k < 8; ++k) {
+            const Position pos = build(k);
+            ASSERT_EQ(book.lookup(pos, 2, out), static_cast<int>(best.size())) << n << " players, symmetry " << k;
+            for (std::size_t m = 0; m < best.size(); ++m) {
+                int x = best[m].first, y = best[m].second;
+                OpeningBook::transform(k, false, side, x, y);
+                EXPECT_EQ(out[m].x, x) << n << " players, symmetry " << k << ", move " << m;
+                EXPECT_EQ(out[m].y, y) << n << " players, symmetry " << k << ", move " << m;
+                EXPECT_EQ(out[m].value, entry.moves[m].value);
+            }
+            EXPECT_EQ(book.lookup(pos, 3 % n, out), 0) << "other seat to place";
+        }
+    }
+    std::remove(path.c_str());
+}
+
+TEST(OpeningBook, CorruptEntriesAreIgnored) {
+    const std::string path = "test_corrupt.book";
+    const std::vector<Player> players = makePlayers(4);
+    Position pos = Position::fromBoard(Board(4), players, 1, 0);
+    pos.placeCell(0, 3, 3);
+    OpeningBook::Key key;
+    ASSERT_TRUE(OpeningBook::keyOf(pos, 1, key));
+
+    // Coups hors du plateau : ignorés ; plus de kBookMoves coups : entrée ignorée.
+    BookEntry entry;
+    entry.key = key.hash;
+    entry.count = 2;
+    entry.moves[0] = { 200, 1, 100 };
+    entry.moves[1] = { 1, 1, 50 };
+    ASSERT_TRUE(OpeningBook::save(path, { entry }));
+    OpeningBook book;
+    std::array<BookMove, kBookMoves> out;
+    ASSERT_TRUE(book.open(path));
+    ASSERT_EQ(book.lookup(pos, 1, out), 1);
+    EXPECT_EQ(out[0].value, 50);
+    entry.count = kBookMoves + 1;
+    ASSERT_TRUE(OpeningBook::save(path, { entry }));
+    ASSERT_TRUE(book.open(path));
+    EXPECT_EQ(book.lookup(pos, 1, out), 0);
+
+    // Aucun emplacement libre : le sondage s’arrête après un tour de table.
+    BookEntry other = entry;
+    other.count = 1;
+    ASSERT_TRUE(OpeningBook::save(path, { other }));
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekg(0, std::ios::end);
+        const std::streamoff entries = (static_cast<std::streamoff>(f.tellg()) - 32) / static_cast<std::streamoff>(sizeof(BookEntry));
+        for (std::streamoff i = 0; i < entries; ++i) {
+            const std::uint64_t filler = key.hash ^ static_cast<std::uint64_t>(i + 1);
+            f.seekp(32 + i * static_cast<std::streamoff>(sizeof(BookEntry)));
+            f.write(reinterpret_cast<const char*>(&filler), sizeof filler);
+        }
+    }
+    ASSERT_TRUE(book.open(path));
+    EXPECT_EQ(book.lookup(pos, 1, out), 0);
+    book.close();
+    std::remove(path.c_str());
+}
+
+TEST(AlphaBetaAgent, DecisionsAreLegalForEverySeatOfOneAgent) {
+    std::mt19937 rng(35);
+    AlphaBetaAgent::Config config;
+    config.maxDepth = 3;
+    config.tableEntries = std::size_t(1) << 14;
+    // Un seul agent pour tous les sièges : sa table, conservée, ne doit pas mêler les points de vue.
+    AlphaBetaAgent agent(config);
+    for (int n : { 2, 4 }) {
+        const std::vector<Player> players = makePlayers(n);
+        for (int game = 0; game < 3; ++game) {
+            Position pos = randomGame(players, 2 * n + static_cast<int>(rng() % (4 * n)), rng);
+            TileBag bag = tileBag();
+            for (int turn = 0; turn < 2 * n; ++turn) {
+                const int tile = static_cast<int>(rng() % catalog().size());
+                const TurnContext ctx{ pos, bag, catalog(), tile };
+                const TurnDecision d = agent.decideTurn(ctx, SearchLimits::within(5.0));
+                expectLegalDecision(ctx, d, std::to_string(n) + " players, seat " + std::to_string(pos.toMove()));
+                if (!d.pass) pos.place(pos.toMove(), catalog()[d.tile].orientations()[d.move.orientation], d.move.x, d.move.y);
+                pos.endTurn();
+            }
+        }
+    }
+}
+
+TEST(AlphaBetaAgent, DecisionRespectsDeadlineAndCancellation) {
+    std::mt19937 rng(35);
+    const std::vector<Player> players = makePlayers(4);
+    const Position pos = randomGame(players, 8, rng);
+    const TileBag& bag = tileBag();
+    const TurnContext ctx{ pos, bag, catalog(), 0 };
+    AlphaBetaAgent::Config config;
+    config.maxDepth = 40;
+    AlphaBetaAgent agent(config);
+
+    // Échéance déjà passée : coup provisoire rendu aussitôt.
+    auto t0 = std::chrono::steady_clock::now();
+    expectLegalDecision(ctx, agent.decideTurn(ctx, SearchLimits::within(0.0)), "expired deadline");
+    EXPECT_LT(secondsSince(t0), 0.25);
+
+    // Échéance lointaine, annulation depuis un autre fil.
+    const SearchLimits limits = SearchLimits::within(60.0);
+    std::thread canceller([token = limits.token] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        token.cancel();
+    });
+    t0 = std::chrono::steady_clock::now();
+    const TurnDecision d = agent.decideTurn(ctx, limits);
+    canceller.join();
+    EXPECT_LT(secondsSince(t0), 1.0);
+    EXPECT_TRUE(agent.lastBudget().cancelled);
+    expectLegalDecision(ctx, d, "cancelled search");
+}
+
+TEST(Ponderer, HintsAndPreparedDecisionsAreLegalAndStopIsPrompt) {
+    std::mt19937 rng(36);
+    const std::vector<Player> players = makePlayers(3);
+    const Position pos = randomGame(players, 6, rng);
+    const TileBag& bag = tileBag();
+    const int tile = 0;
+    const TurnContext ctx{ pos, bag, catalog(), tile };
+
+    Ponderer::Config config;
+    config.hintSeconds = 0.1;
+    config.predictions = 2;
+    // Affinage sans budget : les conseils restent ceux d’où partent les anticipations.
+    config.refineSeconds = 0.0;
+    Ponderer ponderer(config);
+    AlphaBetaAgent::Config botConfig;
+    botConfig.maxDepth = 2;
+    botConfig.seconds = 0.05;
+    AlphaBetaAgent bot(botConfig);
+    ponderer.start(ctx, &bot);
+    std::this_thread::sleep_for(std::chrono::milliseconds(800));
+    auto t0 = std::chrono::steady_clock::now();
+    ponderer.stop();
+    EXPECT_LT(secondsSince(t0), 0.5);
+
+    const std::vector<MctsAgent::Candidate> hints = ponderer.hints(config.predictions);
+    ASSERT_FALSE(hints.empty());
+    int prepared = 0;
+    for (const MctsAgent::Candidate& c : hints) {
+        TurnDecision asDecision;
+        asDecision.exchangeSlot = c.exchangeSlot;
+        asDecision.tile = c.tile;
+        asDecision.pass = false;
+        asDecision.move = c.move;
+        expectLegalDecision(ctx, asDecision, "hint");
+
+        // Position anticipée : le placement conseillé, puis la tuile suivante de la fenêtre.
+        Position next = pos;
+        TileBag nextBag = bag;
+        if (c.exchangeSlot >= 0) {
+            next.useCoupon(next.toMove());
+            nextBag.exchange(c.exchangeSlot, tile);
+        }
+        next.place(next.toMove(), catalog()[c.tile].orientations()[c.move.orientation], c.move.x, c.move.y);
+        next.endTurn();
+        const int nextTile = nextBag.draw(rng);
+        const auto taken = ponderer.take(next, nextBag, nextTile);
+        if (!taken) continue;
+        ++prepared;
+        expectLegalDecision({ next, nextBag, catalog(), nextTile }, taken->decision, "prepared decision");
+    }
+    EXPECT_GT(prepared, 0);
+
+    // Arrêt d’une analyse longue : rendu dès l’annulation.
+    config.hintSeconds = 30.0;
+    Ponderer slow(config);
+    slow.start(ctx, nullptr);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    t0 = std::chrono::steady_clock::now();
+    slow.stop();
+    EXPECT_LT(secondsSince(t0), 0.5);
+}
+
+TEST(TileQueue, WeightedSamplingFollowsWeights) {
+    const std::vector<double> weights{ 1.0, 2.0, 3.0, 0.0, 4.0 };
+    const double total = 10.0;
+    const std::string path = "test_weights.json";
+    writeCatalog(path, weights);
+    const InitTiles tiles(path);
+    ASSERT_EQ(tiles.all().size(), weights.size());
+    const int kDraws = 100000;
+    auto expectFrequencies = [&](const std::vector<int>& counts, int draws, const char* what) {
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            const double expected = weights[i] / total;
+            // 5 écarts-types d’une proportion binomiale.
+            EXPECT_NEAR(counts[i] / double(draws), expected, 5.0 * std::sqrt(0.25 / draws) + 1e-12)
+                << what << ", tile " << i;
+            if (weights[i] == 0.0) EXPECT_EQ(counts[i], 0) << what << ", tile " << i;
+        }
+    };
+
+    // Table d’alias seule.
+    AliasTable alias(weights);
+    std::mt19937 rng(27);
+    std::vector<int> counts(weights.size(), 0);
+    for (int d = 0; d < kDraws; ++d) ++counts[alias.sample(rng)];
+    expectFrequencies(counts, kDraws, "alias table");
+
+    // Tirages avec remise de la pioche.
+    TileQueue with;
+    with.setSamplingMode(TileQueue::SamplingMode::WeightedWithReplacement);
+    ASSERT_TRUE(with.initFrom(tiles, true, 27));
+    std::fill(counts.begin(), counts.end(), 0);
+    for (int d = 0; d < kDraws; ++d) ++counts[*with.shapeIndex(with.draw().getId())];
+    expectFrequencies(counts, kDraws, "with replacement");
+
+    // Ordre pondéré sans remise : chaque tuile de poids > 0 une fois par cycle, la première
+    // tirée avec une probabilité proportionnelle à son poids.
+    TileQueue without;
+    without.setSamplingMode(TileQueue::SamplingMode::WeightedShuffle);
+    ASSERT_TRUE(without.initFrom(tiles, true, 27));
+    const int kCycles = 20000;
+    std::fill(counts.begin(), counts.end(), 0);
+    for (int c = 0; c < kCycles; ++c) {
+        std::vector<int> seen(weights.size(), 0);
+        for (int d = 0; d < 4; ++d) {
+            const std::size_t i = *without.shapeIndex(without.draw().getId());
+            if (d == 0) ++counts[i];
+            ++seen[i];
+        }
+        for (std::size_t i = 0; i < weights.size(); ++i) ASSERT_EQ(seen[i], weights[i] > 0.0 ? 1 : 0) << "cycle " << c;
+    }
+    expectFrequencies(counts, kCycles, "first of weighted order");
+
+    // Ordre du catalogue (sans mélange) : les tuiles de poids nul n’y figurent pas.
+    TileQueue ordered;
+    ordered.setSamplingMode(TileQueue::SamplingMode::WeightedShuffle);
+    ASSERT_TRUE(ordered.initFrom(tiles, false, 27));
+    EXPECT_EQ(ordered.nextTileIds(10), (std::vector<std::string>{ "T0", "T1", "T2", "T4" }));
+    std::remove(path.c_str());
+}
+
+TEST(TileQueue, InitFromRejectsAllZeroWeightsWithoutTouchingTheQueue) {
+    const std::string good = "test_good.json", zero = "test_zero.json";
+    writeCatalog(good, { 1.0, 2.0, 3.0 });
+    writeCatalog(zero, { 0.0, 0.0 });
+    const InitTiles goodTiles(good), zeroTiles(zero);
+    for (auto mode : { TileQueue::SamplingMode::WeightedShuffle, TileQueue::SamplingMode::WeightedWithReplacement }) {
+        TileQueue queue;
+        queue.setSamplingMode(mode);
+        ASSERT_TRUE(queue.initFrom(goodTiles, true, 27));
+        const std::vector<std::string> ids = queue.nextTileIds(10);
+        const std::vector<double> weights = queue.weights();
+        EXPECT_FALSE(queue.initFrom(zeroTiles, true, 27));
+        EXPECT_EQ(queue.nextTileIds(10), ids);
+        EXPECT_EQ(queue.weights(), weights);
+        EXPECT_EQ(queue.shapeCount(), 3u);
+        EXPECT_EQ(queue.remainingOfShape("T0") + queue.remainingOfShape("T1") + queue.remainingOfShape("T2"), queue.size());
+    }
+    // Le mode uniforme ignore les poids.
+    TileQueue uniform;
+    EXPECT_TRUE(uniform.initFrom(zeroTiles, true, 27));
+    EXPECT_EQ(uniform.size(), 2u);
+    std::remove(good.c_str());
+    std::remove(zero.c_str());
+}
+
+TEST(TileQueue, CompositionCountersMatchRecountAcrossDrawExchangeAndReshuffle) {
+    const InitTiles tiles("Shapes.json");
+    std::mt19937 rng(26);
+    for (auto mode : { TileQueue::SamplingMode::Shuffle, TileQueue::SamplingMode::WeightedShuffle,
+                       TileQueue::SamplingMode::WeightedWithReplacement }) {
+        TileQueue queue;
+        queue.setSamplingMode(mode);
+        ASSERT_TRUE(queue.initFrom(tiles, true, 26));
+        std::size_t maxCells = 0;
+        for (const Tile& t : tiles.all()) maxCells = std::max(maxCells, t.getCells().size());
+
+        // Trois cycles complets : tirages, échanges avec la fenêtre et remélanges.
+        const std::size_t steps = 3 * tiles.all().size();
+        for (std::size_t step = 0; step < steps; ++step) {
+            const Tile current = queue.draw();
+            if (rng() % 3 == 0) queue.exchangeWithWindow(rng() % 5, current.getId());
+
+            std::vector<std::size_t> shapes(queue.shapeCount(), 0), sizes(maxCells + 1, 0);
+            for (const Tile& t : queue.peek(queue.size())) {
+                ++shapes[*queue.shapeIndex(t.getId())];
+                ++sizes[t.getCells().size()];
+            }
+            for (std::size_t i = 0; i < shapes.size(); ++i) {
+                ASSERT_EQ(queue.remainingOfShape(i), shapes[i]) << "shape " << i << ", step " << step;
+                ASSERT_EQ(queue.remainingOfShape(tiles.all()[i].getId()), shapes[i]) << "shape " << i;
+            }
+            for (std::size_t n = 0; n < sizes.size(); ++n)
+                ASSERT_EQ(queue.remainingOfSize(n), sizes[n]) << "size " << n << ", step " << step;
+        }
+    }
+}
+
+TEST(Game, SaturationMatchesExhaustiveReferenceSearch) {
+    std::mt19937 rng(31);
+    std::vector<ShapeSet> shapes = catalog();
+    std::stable_sort(shapes.begin(), shapes.end(),
+                     [](const ShapeSet& a, const ShapeSet& b) { return a.cellCount() < b.cellCount(); });
+    const std::vector<ShapeSet> none;
+    int saturated = 0, open = 0;
+    for (int n : { 2, 4 }) {
+        const std::vector<Player> players = makePlayers(n);
+        for (int trial = 0; trial < 12; ++trial) {
+            // Plateau presque plein : chaque case prise par un joueur ou une pierre, sauf quelques trous.
+            Board board(n);
+            const int rows = board.getRows(), cols = board.getCols();
+            const int holes = static_cast<int>(rng() % 12);
+            for (int y = 0; y < rows; ++y) {
+                for (int x = 0; x < cols; ++x) {
+                    if (static_cast<int>(rng() % (rows * cols)) < holes * 4) continue;
+                    if (rng() % 8 == 0) board.placeStone(x, y);
+                    else board.placeTile(x, y, players[rng() % n].getID());
+                }
+            }
+
+            bool expected = true;
+            for (const Player& p : players) {
+                for (const ShapeSet& shape : shapes) {
+                    for (int o = 0; o < static_cast<int>(shape.orientations().size()) && expected; ++o)
+                        for (int y = 0; y < rows && expected; ++y)
+                            for (int x = 0; x < cols && expected; ++x) {
+                                const Move m{ static_cast<std::uint8_t>(o), static_cast<std::uint8_t>(x), static_cast<std::uint8_t>(y) };
+                                if (referenceLegal(board, MoveGenerator::footprint(shape, m), p.getID())) expected = false;
+                            }
+                }
+            }
+            EXPECT_EQ(Game::isSaturated(board, players, shapes), expected) << n << " players, trial " << trial;
+            EXPECT_FALSE(Game::isSaturated(board, players, none));
+            (expected ? saturated : open) += 1;
+        }
+    }
+    // Les deux issues doivent être couvertes.
+    EXPECT_GT(saturated, 0);
+    EXPECT_GT(open, 0);
+}
+
+TEST(Position, BonusSideCountersMatchRecountAfterEveryMove) {
+    std::mt19937 rng(41);
+    MoveList moves;
+    int checked = 0;
+    for (int n : { 2, 5, 9 }) {
+        const std::vector<Player> players = makePlayers(n);
+        for (int game = 0; game < 4; ++game) {
+            Position pos = randomGame(players, 0, rng);
+            // Côtés recomptés sur les territoires : possédé, ou bloqué (hors plateau, pierre,
+            // case d’un autre siège, case vide voisine d’un autre siège).
+            const auto check = [&](const std::string& after) {
+                const auto owner = [&](int x, int y) {
+                    for (int s = 0; s < n; ++s)
+                        if ((pos.owned(s)[y] >> x) & 1u) return s;
+                    return -1;
+                };
+                const auto inside = [&](int x, int y) { return x >= 0 && y >= 0 && x < pos.cols() && y < pos.rows(); };
+                for (int i = 0; i < pos.bonusCount(); ++i) {
+                    const int bx = pos.bonusX(i), by = pos.bonusY(i);
+                    const int sx[4] = { bx - 1, bx + 1, bx, bx }, sy[4] = { by, by, by - 1, by + 1 };
+                    for (int seat = 0; seat < n; ++seat) {
+                        int owned = 0, blocked = 0;
+                        for (int k = 0; k < 4; ++k) {
+                            const int x = sx[k], y = sy[k];
+                            if (!inside(x, y)) { ++blocked; continue; }
+                            const int o = owner(x, y);
+                            if (o == seat) { ++owned; continue; }
+                            if (o >= 0 || !pos.isEmpty(x, y)) { ++blocked; continue; }
+                            bool rival = false;
+                            for (auto [dx, dy] : { std::pair<int,int>{ 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } }) {
+                                const int nx = x + dx, ny = y + dy;
+                                if (inside(nx, ny) && owner(nx, ny) >= 0 && owner(nx, ny) != seat) rival = true;
+                            }
+                            blocked += rival;
+                        }
+                        ASSERT_EQ(pos.bonusOwnedSides(i, seat), owned) << after << ", bonus " << i << ", seat " << seat;
+                        ASSERT_EQ(pos.bonusBlockedSides(i, seat), blocked) << after << ", bonus " << i << ", seat " << seat;
+                        ASSERT_EQ(pos.bonusDistance(i, seat), blocked > 0 ? -1 : 4 - owned);
+                    }
+                }
+                ++checked;
+            };
+            check("start");
+            for (int turn = 0; turn < 12 * n && pos.bonusCount() > 0; ++turn) {
+                const int seat = turn % n;
+                if (rng() % 10 == 0) {
+                    const int x = static_cast<int>(rng() % pos.cols()), y = static_cast<int>(rng() % pos.rows());
+                    if (pos.isEmpty(x, y)) pos.placeStone(x, y);
+                    check("stone");
+                    continue;
+                }
+                // Cases 1x1 sur les côtés d’un bonus : captures fréquentes.
+                if (rng() % 3 == 0) {
+                    const int i = static_cast<int>(rng() % pos.bonusCount());
+                    const BitGrid& anchors = pos.anchors(seat);
+                    const int x = pos.bonusX(i) + static_cast<int>(rng() % 3) - 1, y = pos.bonusY(i) + static_cast<int>(rng() % 3) - 1;
+                    if (x >= 0 && y >= 0 && x < pos.cols() && y < pos.rows() && ((anchors[y] >> x) & 1u)) {
+                        pos.placeCell(seat, x, y);
+                        check("cell");
+                        continue;
+                    }
+                }
+                const ShapeSet& shape = catalog()[rng() % catalog().size()];
+                MoveGenerator::generate(pos.masks(seat), shape, moves);
+                if (moves.empty()) continue;
+                const Move m = moves[rng() % moves.size()];
+                pos.place(seat, shape.orientations()[m.orientation], m.x, m.y);
+                check("placement");
+            }
+        }
+    }
+    EXPECT_GT(checked, 100);
+}
+
+TEST(Territory, ComputeMatchesReferenceBfs) {
+    // Parcours de référence case par case : distance et sièges arrivés au même pas ;
+    // seule une case atteinte par un seul siège est propagée.
+    const auto reference = [](const Position& pos) {
+        const int rows = pos.rows(), cols = pos.cols(), seats = pos.numSeats();
+        std::vector<int> dist(rows * cols, -1);
+        std::vector<unsigned> seen(rows * cols, 0);
+        std::vector<int> level;
+        for (int s = 0; s < seats; ++s)
+            for (int y = 0; y < rows; ++y)
+                for (int x = 0; x < cols; ++x)
+                    if ((pos.owned(s)[y] >> x) & 1u) { dist[y * cols + x] = 0; seen[y * cols + x] = 1u << s; level.push_back(y * cols + x); }
+        Territory t;
+        for (int d = 0; !level.empty(); ++d) {
+            std::vector<int> next;
+            for (int c : level) {
+                if (seen[c] & (seen[c] - 1)) continue;
+                int s = 0;
+                while (!((seen[c] >> s) & 1u)) ++s;
+                const PlacementMasks masks = pos.masks(s);
+                const int cx = c % cols, cy = c / cols;
+                const int nx[4] = { cx - 1, cx + 1, cx, cx }, ny[4] = { cy, cy, cy - 1, cy + 1 };
+                for (int k = 0; k < 4; ++k) {
+                    if (nx[k] < 0 || ny[k] < 0 || nx[k] >= cols || ny[k] >= rows) continue;
+                    if (!((masks.free[ny[k]] >> nx[k]) & 1u)) continue;
+                    const int n = ny[k] * cols + nx[k];
+                    if (dist[n] == -1) { dist[n] = d + 1; seen[n] = 1u << s; next.push_back(n); }
+                    else if (dist[n] == d + 1) seen[n] |= 1u << s;
+                }
+            }
+            if (!next.empty()) t.steps = d + 1;
+            level.swap(next);
+        }
+        for (int c = 0; c < rows * cols; ++c) {
+            if (dist[c] <= 0) continue;
+            const Row bit = Row(1) << (c % cols);
+            if (seen[c] & (seen[c] - 1)) {
+                t.contested[c / cols] |= bit;
+                for (int s = 0; s < seats; ++s) t.contestedArea[s] += (seen[c] >> s) & 1u;
+            } else {
+                int s = 0;
+                while (!((seen[c] >> s) & 1u)) ++s;
+                t.region[s][c / cols] |= bit;
+                ++t.area[s];
+            }
+        }
+        return t;
+    };
+
+    std::mt19937 rng(4242);
+    int contested = 0;
+    for (int n : { 2, 3, 5, 9 }) {
+        const std::vector<Player> players = makePlayers(n);
+        for (int game = 0; game < 6; ++game) {
+            const Position pos = randomGame(players, static_cast<int>(rng() % (8 * n + 1)), rng);
+            const Territory t = Territory::compute(pos);
+            const Territory r = reference(pos);
+            ASSERT_EQ(t.steps, r.steps) << n << " players, game " << game;
+            for (int y = 0; y < pos.rows(); ++y) ASSERT_EQ(t.contested[y], r.contested[y]) << n << " players, game " << game << ", row " << y;
+            for (int s = 0; s < n; ++s) {
+                for (int y = 0; y < pos.rows(); ++y) ASSERT_EQ(t.region[s][y], r.region[s][y]) << n << " players, game " << game << ", seat " << s << ", row " << y;
+                EXPECT_EQ(t.area[s], r.area[s]) << n << " players, game " << game << ", seat " << s;
+                EXPECT_EQ(t.contestedArea[s], r.contestedArea[s]) << n << " players, game " << game << ", seat " << s;
+                contested += r.contestedArea[s];
+            }
+        }
+    }
+    EXPECT_GT(contested, 0);
+}
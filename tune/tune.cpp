@@ -0,0 +1,412 @@
+/**
+* @file tune.cpp
+ * @brief Réglage des poids de l’évaluation linéaire (EvalWeights) par parties contre soi-même
+ *        (à compiler en Release).
+ *
+ * Usage : `tune [parties] [fichier]` — 4000 parties et `weights.json` par défaut ;
+ * `tune match [parties] [fichier]` — match alpha-bêta des poids du fichier contre les poids
+ * par défaut (300 parties par défaut).
+ *
+ * 1. Parties contre soi-même, réparties sur tous les cœurs : 2 à 9 joueurs, chaque siège suit
+ *    une politique HeuristicPolicy tirée au hasard (aléatoire, plus grand carré, bonus,
+ *    blocage) ; au début de certaines manches, les critères (Evaluation::features) de tous les
+ *    sièges sont enregistrés. La pierre d’un Rock bonus est posée sur une ancre adverse tirée
+ *    au hasard (comme Playout) ; la phase 1x1 finale est jouée par Playout.
+ * 2. Chaque position est étiquetée par le résultat final de chaque siège : part des
+ *    adversaires battus, plus grand carré puis cases (Position::rewards, même classement que
+ *    Game::computeScores).
+ * 3. Réglage à la Texel : l’évaluation d’AlphaBetaAgent, e(s) = w·f(s) − max w·f(adversaires),
+ *    prédit le résultat par σ(e / K). K est d’abord ajusté aux poids par défaut, puis les
+ *    poids minimisent l’erreur quadratique moyenne (descente de gradient Adam, gradient calculé
+ *    en parallèle). Les 10 % dernières parties servent de validation.
+ *
+ * Le résultat ne dépend que des arguments, pas du nombre de cœurs : plateaux et bonus sont
+ * tirés d’un générateur à graine fixe, chaque partie a sa propre graine (son indice), et les
+ * sommes parallèles sont faites sur un nombre fixe de tranches, additionnées dans l’ordre.
+ *
+ * Les poids arrondis sont écrits au format de EvalWeights::load ; les bots alpha-bêta du jeu
+ * chargent `weights.json` depuis le dossier courant.
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "AI/AlphaBetaAgent.hpp"
+#include "AI/Evaluation.hpp"
+#include "AI/FinalCellSolver.hpp"
+#include "AI/HeuristicPolicy.hpp"
+#include "Board/Board.hpp"
+#include "Engine/FastRng.hpp"
+#include "Engine/MoveGenerator.hpp"
+#include "Engine/Playout.hpp"
+#include "Engine/Position.hpp"
+#include "Engine/Shape.hpp"
+#include "Engine/Territory.hpp"
+#include "Engine/TileBag.hpp"
+#include "Player/Player.hpp"
+#include "Tile/InitTiles.hpp"
+#include "Tile/TileQueue.hpp"
+
+namespace {
+
+/**
+ * @struct Sample
+ * @brief Position enregistrée : critères de chaque siège et résultat final.
+ */
+struct Sample {
+    int seats = 0;
+    std::array<EvalVector, kMaxPlayers> features{};
+    std::array<float, kMaxPlayers> reward{};
+};
+
+/// Tranches des sommes parallèles (fixe : les arrondis ne dépendent pas du nombre de fils).
+constexpr int kChunks = 64;
+
+/**
+ * @brief Exécute body(i) pour chaque i de [0, n) sur `threads` fils, indices distribués un à
+ *        un ; chaque appel ne doit écrire que dans sa propre case de résultat.
+ */
+template <class Body>
+void parallelFor(int threads, std::size_t n, Body body) {
+    std::atomic<std::size_t> next{ 0 };
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back([&] {
+            for (std::size_t i; (i = next.fetch_add(1)) < n;) body(i);
+        });
+    }
+    for (auto& th : pool) th.join();
+}
+
+/**
+ * @brief Pose la pierre d’un Rock bonus en attente sur une ancre adverse tirée au hasard
+ *        (règle des parties simulées, comme Playout).
+ */
+void playRock(Position& pos, int seat, std::mt19937& rng) {
+    if (!pos.rockPending(seat)) return;
+    std::vector<std::pair<int,int>> targets;
+    for (int s = 0; s < pos.numSeats(); ++s) {
+        if (s == seat) continue;
+        for (int y = 0; y < pos.rows(); ++y)
+            for (Row r = pos.anchors(s)[y]; r; r &= r - 1) targets.emplace_back(lowestBit(r), y);
+    }
+    if (!targets.empty()) {
+        const auto [x, y] = targets[rng() % targets.size()];
+        pos.placeStone(x, y);
+    }
+    pos.clearRock(seat);
+}
+
+/**
+ * @brief Position de départ d’une partie de n joueurs : bonus et cases de départ tirés par `rng`
+ *        (Board et Player ne sont pas réentrants : appeler sur un seul fil).
+ */
+Position startPosition(const std::vector<Player>& players, std::mt19937& rng) {
+    const int n = static_cast<int>(players.size());
+    Board board(n);
+    board.placeBonus(n, rng);
+    const int side = board.getRows();
+    for (const auto& pl : players) {
+        int x, y;
+        do { x = rng() % side; y = rng() % side; } while (board.getGrid()[y][x] != '.');
+        board.placeTile(x, y, pl.getID());
+    }
+    return Position::fromBoard(board, players, 1, 0);
+}
+
+/**
+ * @brief Joue une partie contre soi-même et ajoute ses positions échantillonnées à `out`.
+ */
+void selfPlay(const Position& start, const TileBag& bag0, const std::vector<ShapeSet>& shapes,
+              const Playout& playout, std::uint32_t seed, std::vector<Sample>& out) {
+    using Kind = HeuristicPolicy::Kind;
+    std::mt19937 rng(seed);
+    FastRng fast(seed);
+    const Kind kinds[] = { Kind::Random, Kind::GreedySquare, Kind::BonusSeeker, Kind::Blocker };
+    Position pos = start;
+    TileBag bag = bag0;
+    bag.determinize(rng);
+    std::array<HeuristicPolicy, kMaxPlayers> policy;
+    for (int s = 0; s < pos.numSeats(); ++s) policy[s] = HeuristicPolicy(kinds[rng() % 4]);
+
+    const std::size_t first = out.size();
+    while (!pos.roundsOver()) {
+        const int seat = pos.toMove();
+        if (seat == 0 && rng() % 2 == 0) {
+            const Territory territory = Territory::compute(pos);
+            Sample sample;
+            sample.seats = pos.numSeats();
+            for (int s = 0; s < pos.numSeats(); ++s) sample.features[s] = Evaluation::features(pos, s, territory);
+            out.push_back(sample);
+        }
+        playRock(pos, seat, rng);
+        const int tile = bag.draw(rng);
+        Move m;
+        if (policy[seat].choose(pos, seat, shapes[tile], rng, m))
+            pos.place(seat, shapes[tile].orientations()[m.orientation], m.x, m.y);
+        pos.endTurn();
+    }
+    std::array<float, kMaxPlayers> reward{};
+    Position::rewards(playout.run(pos, bag, -1, fast), pos.numSeats(), reward);
+    for (std::size_t i = first; i < out.size(); ++i) out[i].reward = reward;
+}
+
+/**
+ * @brief Évaluation paranoïaque de chaque siège (comme AlphaBetaAgent::evaluate) ;
+ *        `best[s]` reçoit l’adversaire le mieux évalué.
+ */
+void evaluateSample(const Sample& x, const std::array<double, kEvalFeatures>& w,
+                    std::array<double, kMaxPlayers>& value, std::array<int, kMaxPlayers>& best) {
+    std::array<double, kMaxPlayers> raw{};
+    for (int s = 0; s < x.seats; ++s)
+        for (int i = 0; i < kEvalFeatures; ++i) raw[s] += w[i] * x.features[s][i];
+    for (int s = 0; s < x.seats; ++s) {
+        best[s] = -1;
+        for (int t = 0; t < x.seats; ++t)
+            if (t != s && (best[s] < 0 || raw[t] > raw[best[s]])) best[s] = t;
+        value[s] = raw[s] - raw[best[s]];
+    }
+}
+
+double sigmoid(double v) { return 1.0 / (1.0 + std::exp(-v)); }
+
+/**
+ * @struct Fit
+ * @brief Erreur quadratique moyenne, gradient et précision (vainqueur prédit) d’un jeu de poids.
+ */
+struct Fit {
+    double loss = 0.0;
+    std::array<double, kEvalFeatures> gradient{};
+    double accuracy = 0.0;
+};
+
+/**
+ * @brief Erreur et gradient sur [begin, end), calculés en parallèle par kChunks tranches.
+ */
+Fit fit(const std::vector<Sample>& data, std::size_t begin, std::size_t end,
+        const std::array<double, kEvalFeatures>& w, double k, int threads) {
+    std::vector<Fit> parts(kChunks);
+    std::vector<std::size_t> terms(kChunks, 0), decided(kChunks, 0);
+    parallelFor(threads, kChunks, [&](std::size_t t) {
+        const std::size_t b = (end - begin) * t / kChunks, e = (end - begin) * (t + 1) / kChunks;
+        Fit& part = parts[t];
+        std::array<double, kMaxPlayers> value{};
+        std::array<int, kMaxPlayers> best{};
+        for (std::size_t j = begin + b; j < begin + e; ++j) {
+            const Sample& x = data[j];
+            evaluateSample(x, w, value, best);
+            int predicted = 0, winner = 0;
+            bool tie = false;
+            for (int s = 0; s < x.seats; ++s) {
+                const double p = sigmoid(value[s] / k);
+                const double err = p - x.reward[s];
+                part.loss += err * err;
+                const double g = 2.0 * err * p * (1.0 - p) / k;
+                for (int i = 0; i < kEvalFeatures; ++i)
+                    part.gradient[i] += g * (x.features[s][i] - x.features[best[s]][i]);
+                if (value[s] > value[predicted]) predicted = s;
+                if (x.reward[s] > x.reward[winner]) { winner = s; tie = false; }
+                else if (s != winner && x.reward[s] == x.reward[winner]) tie = true;
+            }
+            terms[t] += x.seats;
+            if (!tie) {
+                ++decided[t];
+                part.accuracy += predicted == winner;
+            }
+        }
+    });
+    Fit total;
+    std::size_t n = 0, d = 0;
+    for (int t = 0; t < kChunks; ++t) {
+        total.loss += parts[t].loss;
+        total.accuracy += parts[t].accuracy;
+        for (int i = 0; i < kEvalFeatures; ++i) total.gradient[i] += parts[t].gradient[i];
+        n += terms[t];
+        d += decided[t];
+    }
+    total.loss /= std::max<std::size_t>(n, 1);
+    total.accuracy /= std::max<std::size_t>(d, 1);
+    for (double& g : total.gradient) g /= std::max<std::size_t>(n, 1);
+    return total;
+}
+
+std::array<double, kEvalFeatures> toReal(const EvalWeights& weights) {
+    std::array<double, kEvalFeatures> w{};
+    for (int i = 0; i < kEvalFeatures; ++i) w[i] = weights.values[i];
+    return w;
+}
+
+/**
+ * @brief Match alpha-bêta : poids réglés contre poids par défaut, mêmes réglages de recherche
+ *        (profondeur 3, sans échange). Chaque départ (2 à 4 joueurs) est joué deux fois, les
+ *        camps échangés (sièges pairs puis impairs) ; pierres et phase finale sont jouées par
+ *        les agents (Agent::chooseStone, FinalCellSolver). Les points d’un camp sont la somme
+ *        des récompenses (Position::rewards) de ses sièges.
+ */
+int runMatch(int games, const std::string& file, const std::vector<ShapeSet>& shapes, const TileBag& bag0,
+             int threads) {
+    EvalWeights tuned;
+    if (!tuned.load(file)) {
+        std::fprintf(stderr, "Error : cannot read %s\n", file.c_str());
+        return 1;
+    }
+    std::mt19937 rng(2025);
+    std::array<std::vector<Player>, kMaxPlayers + 1> players;
+    std::vector<Position> starts;
+    for (int g = 0; g < (games + 1) / 2; ++g) {
+        const int n = 2 + g % 3;
+        if (players[n].empty())
+            for (int p = 0; p < n; ++p) players[n].emplace_back("p" + std::to_string(p), "red");
+        starts.push_back(startPosition(players[n], rng));
+    }
+
+    std::vector<std::array<double, 2>> points(games);
+    parallelFor(threads, static_cast<std::size_t>(games), [&](std::size_t g) {
+        AlphaBetaAgent::Config config;
+        config.maxDepth = 3;
+        config.seconds = 3600.0;
+        config.exchanges = false;
+        config.tableEntries = std::size_t(1) << 16;
+        AlphaBetaAgent defaults(config);
+        config.weights = tuned;
+        AlphaBetaAgent challenger(config);
+        // Camp 1 (poids réglés) : sièges de parité g.
+        const auto side = [&](int seat) { return static_cast<int>((seat + g) % 2); };
+
+        Position pos = starts[g / 2];
+        TileBag bag = bag0;
+        std::mt19937 local(static_cast<std::uint32_t>(3000 + g / 2));
+        bag.determinize(local);
+        while (!pos.roundsOver()) {
+            const int seat = pos.toMove();
+            Agent& agent = side(seat) ? static_cast<Agent&>(challenger) : defaults;
+            if (pos.rockPending(seat)) {
+                if (const auto cell = agent.chooseStone(pos, seat)) pos.placeStone(cell->first, cell->second);
+                pos.clearRock(seat);
+            }
+            const int tile = bag.draw(local);
+            const TurnDecision d = agent.decideTurn({ pos, bag, shapes, tile });
+            if (!d.pass) pos.place(seat, shapes[d.tile].orientations()[d.move.orientation], d.move.x, d.move.y);
+            pos.endTurn();
+        }
+        const auto plan = FinalCellSolver::solve(pos);
+        for (int seat = 0; seat < pos.numSeats(); ++seat) {
+            if (!plan[seat]) continue;
+            pos.useCoupon(seat);
+            pos.placeCell(seat, plan[seat]->x, plan[seat]->y);
+        }
+        std::array<float, kMaxPlayers> reward{};
+        pos.rewards(reward);
+        for (int seat = 0; seat < pos.numSeats(); ++seat) points[g][side(seat)] += reward[seat];
+    });
+    double total[2] = { 0.0, 0.0 };
+    for (const auto& p : points) {
+        total[0] += p[0];
+        total[1] += p[1];
+    }
+    std::printf("%d alpha-beta games (2 to 4 players, depth 3): %s %.1f points, default weights %.1f points\n",
+                games, file.c_str(), total[1], total[0]);
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool match = argc > 1 && std::string(argv[1]) == "match";
+    if (match) {
+        --argc;
+        ++argv;
+    }
+    const int games = argc > 1 ? std::max(10, std::atoi(argv[1])) : match ? 300 : 4000;
+    const std::string output = argc > 2 ? argv[2] : "weights.json";
+    const int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    InitTiles catalog("Shapes.json");
+    if (catalog.all().empty()) {
+        std::fprintf(stderr, "Error : cannot load Shapes.json\n");
+        return 1;
+    }
+    std::vector<ShapeSet> shapes;
+    for (const auto& t : catalog.all()) shapes.emplace_back(t);
+    const Playout playout(shapes);
+    TileQueue queue;
+    queue.setSamplingMode(TileQueue::SamplingMode::WeightedShuffle);
+    queue.initFrom(catalog, true, 7);
+    const TileBag bag = TileBag::fromQueue(queue, queue.weights());
+    if (match) return runMatch(games, output, shapes, bag, threads);
+
+    // Positions de départ construites sur ce fil (Board et Player ne sont pas réentrants).
+    std::mt19937 rng(2024);
+    std::array<std::vector<Player>, kMaxPlayers + 1> players;
+    std::vector<Position> starts;
+    for (int g = 0; g < games; ++g) {
+        const int n = 2 + static_cast<int>(rng() % 8);
+        if (players[n].empty())
+            for (int p = 0; p < n; ++p) players[n].emplace_back("p" + std::to_string(p), "red");
+        starts.push_back(startPosition(players[n], rng));
+    }
+
+    // Une graine par partie ; les 10 % dernières parties forment la validation.
+    std::vector<std::vector<Sample>> perGame(games);
+    parallelFor(threads, starts.size(), [&](std::size_t g) {
+        selfPlay(starts[g], bag, shapes, playout, static_cast<std::uint32_t>(1000 + g), perGame[g]);
+    });
+    const int trainGames = games - games / 10;
+    std::vector<Sample> data;
+    std::size_t trainEnd = 0;
+    for (int g = 0; g < games; ++g) {
+        data.insert(data.end(), perGame[g].begin(), perGame[g].end());
+        if (g + 1 == trainGames) trainEnd = data.size();
+    }
+    std::printf("%d games on %d threads: %zu positions (%zu training, %zu validation)\n",
+                games, threads, data.size(), trainEnd, data.size() - trainEnd);
+
+    // K : échelle de la sigmoïde la mieux adaptée aux poids par défaut (recherche dorée).
+    const std::array<double, kEvalFeatures> initial = toReal(EvalWeights{});
+    double lo = std::log(50.0), hi = std::log(50000.0);
+    for (int it = 0; it < 40; ++it) {
+        const double a = hi - (hi - lo) * 0.618, b = lo + (hi - lo) * 0.618;
+        if (fit(data, 0, trainEnd, initial, std::exp(a), threads).loss
+            < fit(data, 0, trainEnd, initial, std::exp(b), threads).loss) hi = b;
+        else lo = a;
+    }
+    const double k = std::exp(0.5 * (lo + hi));
+    const Fit before = fit(data, trainEnd, data.size(), initial, k, threads);
+    std::printf("K = %.0f, default weights: validation error %.5f, winner predicted %.1f%%\n",
+                k, before.loss, 100.0 * before.accuracy);
+
+    // Adam, pas décroissant (en unités de poids).
+    std::array<double, kEvalFeatures> w = initial, m{}, v{};
+    const int iterations = 600;
+    for (int it = 1; it <= iterations; ++it) {
+        const Fit f = fit(data, 0, trainEnd, w, k, threads);
+        const double rate = 0.1 + 4.0 * (1.0 - double(it) / iterations);
+        for (int i = 0; i < kEvalFeatures; ++i) {
+            m[i] = 0.9 * m[i] + 0.1 * f.gradient[i];
+            v[i] = 0.999 * v[i] + 0.001 * f.gradient[i] * f.gradient[i];
+            const double mh = m[i] / (1.0 - std::pow(0.9, it)), vh = v[i] / (1.0 - std::pow(0.999, it));
+            w[i] -= rate * mh / (std::sqrt(vh) + 1e-12);
+        }
+        if (it % 100 == 0) std::printf("  iteration %d: training error %.5f\n", it, f.loss);
+    }
+
+    EvalWeights tuned;
+    for (int i = 0; i < kEvalFeatures; ++i) tuned.values[i] = static_cast<int>(std::lround(w[i]));
+    const Fit after = fit(data, trainEnd, data.size(), toReal(tuned), k, threads);
+    std::printf("tuned weights: validation error %.5f, winner predicted %.1f%%\n", after.loss, 100.0 * after.accuracy);
+    for (int i = 0; i < kEvalFeatures; ++i)
+        std::printf("  %-9s %6d (default %d)\n", EvalWeights::name(i), tuned.values[i], EvalWeights{}.values[i]);
+    if (!tuned.save(output)) {
+        std::fprintf(stderr, "Error : cannot write %s\n", output.c_str());
+        return 1;
+    }
+    std::printf("weights written to %s\n", output.c_str());
+    return 0;
+}